@@ -61,23 +61,13 @@ int32_t ad400x_spi_reg_read(struct ad400x_dev *dev,
 {
 	int32_t ret;
 	uint8_t buf[2];
-	uint32_t spi_clk_hz_tmp = (uint32_t) -1;
 
 	buf[0] = AD400X_READ_COMMAND;
 	buf[1] = 0xFF;
 
-	// register access runs at a lower clock rate (~2MHz)
-	if (dev->spi_desc->spi_clk_hz > dev->spi_desc->spi_clk_hz_reg_access) {
-		spi_clk_hz_tmp = dev->spi_desc->spi_clk_hz;
-		dev->spi_desc->spi_clk_hz = dev->spi_desc->spi_clk_hz_reg_access;
-	}
-
-	ret = spi_write_and_read(dev->spi_desc, buf, 2);
+	ret = spi_engine_write_and_read(dev->spi_desc, buf, 2);
 	*reg_data = buf[1];
 
-	if (spi_clk_hz_tmp != (uint32_t) -1)
-		dev->spi_desc->spi_clk_hz = spi_clk_hz_tmp;
-
 	return ret;
 }
 
@@ -90,22 +80,12 @@ int32_t ad400x_spi_reg_read(struct ad400x_dev *dev,
 int32_t ad400x_spi_reg_write(struct ad400x_dev *dev,
 			     uint8_t reg_data)
 {
-	int32_t ret;
 	uint8_t buf[2];
-	uint32_t spi_clk_hz_tmp;
-
-	// register access runs at a lower clock rate (~2MHz)
-	spi_clk_hz_tmp = dev->spi_desc->spi_clk_hz;
-	dev->spi_desc->spi_clk_hz = 2000000;
 
 	buf[0] = AD400X_WRITE_COMMAND;
 	buf[1] = reg_data | AD400X_RESERVED_MSK;
 
-	ret = spi_write_and_read(dev->spi_desc, buf, 2);
-
-	dev->spi_desc->spi_clk_hz = spi_clk_hz_tmp;
-
-	return ret;
+	return spi_engine_write_and_read(dev->spi_desc, buf, 2);
 }
 
 /**
@@ -117,15 +97,16 @@ int32_t ad400x_spi_reg_write(struct ad400x_dev *dev,
 int32_t ad400x_spi_single_conversion(struct ad400x_dev *dev,
 				     uint32_t *adc_data)
 {
-	uint32_t buf = 0;
+	uint32_t data;
 	int32_t ret;
 
-	spi_set_transfer_length(dev->spi_desc, dev->spi_desc->max_data_width);
-	ret = spi_write_and_read(dev->spi_desc, &buf, 4);
+	ret = spi_engine_program_run(dev->spi_desc, &dev->conv_prog, &data);
+	if (ret < 0)
+		return ret;
 
-	*adc_data = buf & 0xFFFFF;
+	*adc_data = data & 0xFFFFF;
 
-	return ret;
+	return 0;
 }
 
 /**
@@ -142,23 +123,38 @@ int32_t ad400x_init(struct ad400x_dev **device,
 	int32_t ret;
 	uint8_t data = 0;
 
-	dev = (struct ad400x_dev *)malloc(sizeof(*dev));
+	dev = (struct ad400x_dev *)calloc(1, sizeof(*dev));
 	if (!dev)
 		return -1;
 
-	ret = spi_init(&dev->spi_desc, init_param.spi_init);
-	if (ret < 0)
-		goto error;
+	ret = spi_engine_init(&dev->spi_desc, &init_param.spi_init);
+	if (ret < 0) {
+		free(dev);
+		return ret;
+	}
 
 	dev->dev_id = init_param.dev_id;
-	dev->spi_desc->cs_delay = init_param.spi_init.cs_delay;
 
-	dev->spi_desc->max_data_width = init_param.num_bits;
+	/* The conversion result is read in a single num_bits word. */
+	ret = spi_engine_set_transfer_width(dev->spi_desc, init_param.num_bits);
+	if (ret < 0)
+		goto error;
+	spi_engine_program_init(dev->spi_desc, &dev->conv_prog);
+	spi_engine_program_cs(dev->spi_desc, &dev->conv_prog, true);
+	spi_engine_program_transfer(&dev->conv_prog, NULL, true, 1);
+	spi_engine_program_cs(dev->spi_desc, &dev->conv_prog, false);
+	ret = spi_engine_program_end(&dev->conv_prog);
+	if (ret < 0)
+		goto error;
+
+	/* Register accesses are 16-bit frames at a lower clock rate. */
+	spi_engine_set_transfer_width(dev->spi_desc, 16);
+	if (init_param.spi_clk_hz_reg_access)
+		spi_engine_set_speed(dev->spi_desc,
+				     init_param.spi_clk_hz_reg_access);
 
-	spi_set_transfer_length(dev->spi_desc, 16);
 	ad400x_spi_reg_read(dev, &data);
 
-	spi_set_transfer_length(dev->spi_desc, dev->spi_desc->max_data_width);
 	data = AD400X_TURBO_MODE(init_param.turbo_mode) |
 	       AD400X_HIGH_Z_MODE(init_param.high_z_mode) |
 	       AD400X_SPAN_COMPRESSION(init_param.span_compression) |
@@ -185,7 +181,7 @@ int32_t ad400x_remove(struct ad400x_dev *dev)
 {
 	int32_t ret;
 
-	ret = spi_remove(dev->spi_desc);
+	ret = spi_engine_remove(dev->spi_desc);
 
 	free(dev);
 
@@ -63,14 +63,18 @@ enum ad400x_supported_dev_ids {
 
 struct ad400x_dev {
 	/* SPI */
-	spi_desc *spi_desc;
+	struct spi_engine_desc *spi_desc;
+	/* Conversion readout, runs at the full SPI clock */
+	struct spi_engine_program conv_prog;
 	/* Device Settings */
 	enum ad400x_supported_dev_ids dev_id;
 };
 
 struct ad400x_init_param {
 	/* SPI */
-	spi_init_param spi_init;
+	struct spi_engine_init_param spi_init;
+	/* SPI clock of the register accesses */
+	uint32_t spi_clk_hz_reg_access;
 	/* Device Settings */
 	enum ad400x_supported_dev_ids dev_id;
 	uint8_t num_bits;
@@ -84,6 +88,8 @@ int32_t ad400x_spi_reg_read(struct ad400x_dev *dev,
 			    uint8_t *reg_data);
 int32_t ad400x_spi_reg_write(struct ad400x_dev *dev,
 			     uint8_t reg_data);
+int32_t ad400x_spi_single_conversion(struct ad400x_dev *dev,
+				     uint32_t *adc_data);
 int32_t ad400x_init(struct ad400x_dev **device,
 		    struct ad400x_init_param init_param);
 int32_t ad400x_remove(struct ad400x_dev *dev);
@@ -7,6 +7,8 @@
 #include <xparameters.h>
 #include "xil_printf.h"
 #include "spi_engine.h"
+#include "axi_dmac.h"
+#include "delay.h"
 #include "ad400x.h"
 
 /******************************************************************************/
@@ -18,51 +20,49 @@
 
 #define SPI_ENGINE_OFFLOAD_EXAMPLE	1
 
+#define AD400X_OFFLOAD_SLOT		0
+#define AD400X_OFFLOAD_RX_ADDR		0x800000
+#define AD400X_OFFLOAD_BUFFERS		4
+/* Conversions per buffer, one 32-bit word each */
+#define AD400X_OFFLOAD_SAMPLES		250
+
 struct ad400x_init_param ad400x_init_param = {
 	/* SPI engine*/
 	{
-		AD400X_SPI_ENGINE_BASEADDR,	/* adc_baseaddr */
+		AD400X_SPI_ENGINE_BASEADDR,	/* base */
 		AD400x_SPI_CS,			/* chip_select */
 		2,				/* cs_delay */
-		0,				/* spi_config */
-		83333333,			/* spi_clk_hz */
-		2000000,			/* spi_clk_hz_reg_access */
+		0,				/* config */
 		166666667,			/* ref_clk_hz */
-		1,				/* spi_offload_rx_support_en */
-		AD400X_DMA_BASEADDR,		/* spi_offload_rx_dma_baseaddr */
-		1,				/* spi_offload_tx_support_en */
-		AD400X_DMA_BASEADDR		/* spi_offload_tx_dma_baseaddr */
+		83333333			/* spi_clk_hz */
 	},
+	2000000,				/* spi_clk_hz_reg_access */
 	ID_AD4003, 20, /* dev_id, num_bits */
 	1,0,0,0,
 };
 
-/**
- * @brief Generate miliseconds delay.
- * @param msecs - Delay in miliseconds.
- * @return None.
- */
-void mdelay(uint32_t msecs)
-{
-	usleep(msecs * 1000);
-}
+struct axi_dmac_init ad400x_dmac_init = {
+	"ad400x_dmac",
+	AD400X_DMA_BASEADDR,
+	DMA_DEV_TO_MEM,
+	0,
+	false
+};
 
 int main()
 {
 	struct ad400x_dev *dev;
+	struct axi_dmac *dmac;
+	struct spi_engine_stream_init stream_init;
+	struct spi_engine_stream *stream;
+	struct axi_dmac_stream_buf *bufs[AD400X_OFFLOAD_BUFFERS];
 	uint32_t *offload_data;
 	uint32_t adc_data;
-	spi_eng_msg *msg;
 	int32_t ret, data;
-	uint32_t i;
+	uint32_t i, n;
 
 	print("Test\n\r");
 
-	uint32_t spi_eng_msg_cmds[3] = { CS_DEASSERT,
-					 TRANSFER_BYTES_R(2),
-					 CS_ASSERT
-				       };
-
 	Xil_ICacheEnable();
 	Xil_DCacheEnable();
 
@@ -78,42 +78,56 @@ int main()
 	}
 	/* Offload example */
 	else {
-		msg = (spi_eng_msg *)malloc(sizeof(*msg));
-		if (!msg)
-			return -1;
-
-		msg->spi_msg_cmds = spi_eng_msg_cmds;
-		msg->msg_cmd_len = ARRAY_SIZE(spi_eng_msg_cmds);
-		msg->rx_buf_addr = 0x800000;
-		msg->tx_buf_addr = 0xA000000;
-		msg->tx_buf[0] = 0xFF;
-		msg->tx_buf[1] = 0xFF;
-
-		/* Init the rx buffer with 0s */
-		memset(msg->rx_buf, 0, 4 * ARRAY_SIZE(msg->rx_buf));
-
-		spi_eng_offload_load_msg(dev->spi_desc, msg);
-		spi_eng_transfer_multiple_msgs(dev->spi_desc, 1000);
-
-		mdelay(2000);
-
-		free(msg);
-
-		offload_data = (uint32_t *)dev->spi_desc->rx_dma_startaddr;
-
-		for(i = 0; i < dev->spi_desc->rx_length/4; i++) {
-			data = *offload_data & 0xFFFFF;
-			if (data > 524287)
-				data = data - 1048576;
-			printf("ADC%d: %d\n", i, data);
-			offload_data += 1;
+		ret = axi_dmac_init(&dmac, &ad400x_dmac_init);
+		if (ret < 0)
+			return ret;
+
+		stream_init.slot = AD400X_OFFLOAD_SLOT;
+		stream_init.prog = &dev->conv_prog;
+		stream_init.dmac = dmac;
+		stream_init.ring.address = AD400X_OFFLOAD_RX_ADDR;
+		stream_init.ring.size = AD400X_OFFLOAD_SAMPLES * 4;
+		stream_init.ring.num_buffers = AD400X_OFFLOAD_BUFFERS;
+		stream_init.ring.filled = NULL;
+		stream_init.ring.ctx = NULL;
+		ret = spi_engine_stream_init(&stream, dev->spi_desc,
+					     &stream_init);
+		if (ret < 0)
+			return ret;
+
+		/* Hold every buffer of the ring: one gap-free capture. */
+		ret = spi_engine_stream_start(stream);
+		for (n = 0; (ret == 0) && (n < AD400X_OFFLOAD_BUFFERS); n++)
+			ret = spi_engine_stream_get(stream, &bufs[n], 2000);
+		spi_engine_stream_stop(stream);
+		if (ret < 0)
+			return ret;
+
+		for (n = 0; n < AD400X_OFFLOAD_BUFFERS; n++) {
+			Xil_DCacheInvalidateRange(bufs[n]->address,
+						  bufs[n]->size);
+			if (bufs[n]->gap || (bufs[n]->seq != bufs[0]->seq + n))
+				printf("Samples lost\n");
+			offload_data = (uint32_t *)bufs[n]->address;
+			for(i = 0; i < AD400X_OFFLOAD_SAMPLES; i++) {
+				data = *offload_data & 0xFFFFF;
+				if (data > 524287)
+					data = data - 1048576;
+				printf("ADC%d: %d\n",
+				       n * AD400X_OFFLOAD_SAMPLES + i, data);
+				offload_data += 1;
+			}
+			spi_engine_stream_release(stream, bufs[n]);
 		}
-	}
 
-	spi_eng_write(dev->spi_desc, SPI_ENGINE_REG_OFFLOAD_CTRL(0), 0x0000);
+		spi_engine_stream_remove(stream);
+		axi_dmac_remove(dmac);
+	}
 
 	print("Success\n\r");
 
+	ad400x_remove(dev);
+
 	Xil_DCacheDisable();
 	Xil_ICacheDisable();
 }
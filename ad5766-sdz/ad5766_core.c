@@ -168,13 +168,13 @@ int32_t ad5766_core_setup(ad5766_core **ad_core,
 	ad5766_core	*core;
 	uint32_t	ref_clk_hz = 100000000;
 	uint32_t	rate_reg;
-	uint32_t	clk_div = 0;
-	uint8_t		spi_config = SPI_ENGINE_CONFIG_CPHA;
-	uint8_t		chip_select = 0;
-	uint32_t	sync_id = 0;
-	uint8_t		size = 3;
+	struct spi_engine_program *prog;
+	int32_t		ret;
 
-	core = (ad5766_core *)malloc(sizeof(*core));
+	if (!init_param.spi_desc)
+		return FAILURE;
+
+	core = (ad5766_core *)calloc(1, sizeof(*core));
 	if (!core)
 		return FAILURE;
 
@@ -183,6 +183,7 @@ int32_t ad5766_core_setup(ad5766_core **ad_core,
 	core->dma_source_addr = init_param.dma_source_addr;
 	core->rate_hz = init_param.rate_hz;
 	core->spi_clk_hz = init_param.spi_clk_hz;
+	core->spi_desc = init_param.spi_desc;
 
 	rate_reg = ref_clk_hz / core->rate_hz;
 	if (rate_reg > 0xFFFF){
@@ -210,27 +211,21 @@ int32_t ad5766_core_setup(ad5766_core **ad_core,
 	ad5766_core_write(core, 0x00000040, 0x0003);
 	ad5766_core_write(core, 0x0000004C, rate_reg);
 
-	clk_div = (ref_clk_hz / core->spi_clk_hz) - 1;
-
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_RESET(0), 0x0001);
-
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0),
-			SPI_ENGINE_CMD_WRITE(SPI_ENGINE_CMD_REG_CONFIG, spi_config));
-
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0),
-			SPI_ENGINE_CMD_WRITE(SPI_ENGINE_CMD_REG_CLK_DIV, clk_div));
-
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0),
-			SPI_ENGINE_CMD_ASSERT(1, (0xff ^ BIT(chip_select))));
-
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0),
-			SPI_ENGINE_CMD_TRANSFER(1, 0, size -1));
-
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0),
-			SPI_ENGINE_CMD_SYNC(sync_id));
-
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0),
-			SPI_ENGINE_CMD_ASSERT(1, 0xff));
+	/* Each sample is a 24-bit frame streamed by the core to the offload. */
+	prog = &core->offload_prog;
+	spi_engine_set_transfer_width(core->spi_desc, 8);
+	spi_engine_set_speed(core->spi_desc, core->spi_clk_hz);
+	spi_engine_program_init(core->spi_desc, prog);
+	spi_engine_program_cs(core->spi_desc, prog, true);
+	spi_engine_program_stream_write(prog, 3);
+	spi_engine_program_cs(core->spi_desc, prog, false);
+	ret = spi_engine_program_end(prog);
+	if (ret == SUCCESS)
+		ret = spi_engine_offload_load(core->spi_desc, 0, prog);
+	if (ret != SUCCESS) {
+		free(core);
+		return ret;
+	}
 
 	ad5766_dma_write(core, 0x400, 0x0);
 
@@ -287,7 +282,7 @@ int32_t ad5766_core_setup(ad5766_core **ad_core,
 	ad5766_dma_write(core, 0x40C, 0x1);
 	ad5766_dma_write(core, 0x408, 0x1);
 
-	spi_engine_offload_enable(1);
+	spi_engine_offload_enable(core->spi_desc, 0, true);
 
 	*ad_core = core;
 
@@ -48,6 +48,8 @@ typedef struct {
 	uint32_t dma_source_addr;
 	uint32_t rate_hz;
 	uint32_t spi_clk_hz;
+	struct spi_engine_desc *spi_desc;
+	struct spi_engine_program offload_prog;
 } ad5766_core;
 
 typedef struct {
@@ -56,6 +58,7 @@ typedef struct {
 	uint32_t dma_source_addr;
 	uint32_t rate_hz;
 	uint32_t spi_clk_hz;
+	struct spi_engine_desc *spi_desc;
 } ad5766_core_init_param;
 
 /******************************************************************************/
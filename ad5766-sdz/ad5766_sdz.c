@@ -94,6 +94,7 @@ int main(void)
 
 	ad5766_setup(&dev, default_init_param);
 
+	default_core_init_param.spi_desc = dev->spi_dev.engine_desc;
 	ad5766_core_setup(&core, default_core_init_param);
 
 	xil_printf("Done\n");
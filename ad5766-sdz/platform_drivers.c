@@ -41,13 +41,7 @@
 /***************************** Include Files **********************************/
 /******************************************************************************/
 #include <xparameters.h>
-#ifdef _XPARAMETERS_PS_H_
-#include <sleep.h>
-#else
-#include <microblaze_sleep.h>
-#endif
 #include "platform_drivers.h"
-#include "spi_engine.h"
 
 /******************************************************************************/
 /************************ Variables Definitions *******************************/
@@ -64,6 +58,7 @@ int32_t spi_init(spi_device *dev)
 	uint8_t	 clk_pha;
 	uint8_t	 clk_pol;
 	uint32_t spi_options = 0;
+	struct spi_engine_init_param engine_init;
 
 	clk_pha = (dev->mode & SPI_CPHA) >> 0;
 	clk_pol = (dev->mode & SPI_CPOL) >> 1;
@@ -114,8 +109,15 @@ int32_t spi_init(spi_device *dev)
 #endif
 		break;
 	case SPI_ENGINE:
-		spi_engine_setup(XPAR_SPI_AXI_BASEADDR);
-		break;
+		engine_init.base = XPAR_SPI_AXI_BASEADDR;
+		engine_init.chip_select = dev->chip_select;
+		engine_init.cs_delay = 1;
+		engine_init.config = (clk_pha ? SPI_ENGINE_CONFIG_CPHA : 0) |
+							 (clk_pol ? SPI_ENGINE_CONFIG_CPOL : 0);
+		engine_init.ref_clk_hz = 100000000;
+		engine_init.spi_clk_hz = 1000000;
+
+		return spi_engine_init(&dev->engine_desc, &engine_init);
 	default:
 		return -1;
 	}
@@ -156,8 +158,8 @@ int32_t spi_write_and_read(spi_device *dev,
 #endif
 		break;
 	case SPI_ENGINE:
-		spi_engine_write_and_read(dev->chip_select, data, bytes_number);
-		break;
+		return spi_engine_write_and_read(dev->engine_desc, data,
+										 bytes_number);
 	default:
 		return -1;
 	}
@@ -388,28 +390,3 @@ int32_t gpio_get_value(gpio_device *dev,
 	return 0;
 #endif
 }
-
-/***************************************************************************//**
-* @brief mdelay
-*******************************************************************************/
-void mdelay(uint32_t msecs)
-{
-#ifdef _XPARAMETERS_PS_H_
-	usleep(msecs * 1000);
-#else
-	MB_Sleep(msecs);
-#endif
-}
-
-/***************************************************************************//**
-* @brief do_div
-*******************************************************************************/
-uint64_t do_div(uint64_t* n, uint64_t base)
-{
-	uint64_t mod = 0;
-
-	mod = *n % base;
-	*n = *n / base;
-
-	return mod;
-}
@@ -43,13 +43,6 @@
 /******************************************************************************/
 /********************** Macros and Constants Definitions **********************/
 /******************************************************************************/
-/*
- * Create a contiguous bitmask starting at bit position @l and ending at
- * position @h.
- */
-#define GENMASK(h, l) \
-		(((~0UL) - (1UL << (l)) + 1) & (~0UL >> (31 - (h))))
-
 /*
  * AD713X registers definition
  */
@@ -49,6 +49,7 @@
 #include <xparameters.h>
 #include "xil_printf.h"
 #include "spi_engine.h"
+#include "axi_dmac.h"
 #include "platform_drivers.h"
 #include "ad713x.h"
 
@@ -59,6 +60,11 @@
 #define AD7134_DMA_BASEADDR             XPAR_AXI_AD7134_DMA_BASEADDR
 #define AD7134_SPI_ENGINE_BASEADDR      XPAR_DUAL_AD7134_AXI_BASEADDR
 #define AD7134_SPI_CS                   0
+#define AD7134_OFFLOAD_SLOT		0
+#define AD7134_OFFLOAD_RX_ADDR		0x800000
+#define AD7134_OFFLOAD_BUFFERS		4
+/* Samples per buffer, one 32-bit word each */
+#define AD7134_OFFLOAD_SAMPLES		256
 #define GPIO_DEVICE_ID			XPAR_PS7_GPIO_0_DEVICE_ID
 #define GPIO_OFFSET			54
 #define GPIO_RESETN_1			GPIO_OFFSET + 32
@@ -80,16 +86,21 @@
 #define GPIO_PINBSPI			GPIO_OFFSET + 48
 #define GPIO_DCLKMODE			GPIO_OFFSET + 49
 
-spi_eng_init_param spi_eng_init_params = {
-	AD7134_SPI_ENGINE_BASEADDR,    // adc_baseaddr
+struct spi_engine_init_param spi_eng_init_params = {
+	AD7134_SPI_ENGINE_BASEADDR,    // base
 	AD7134_SPI_CS,                 // chip_select
-	SPI_MODE_1,                    // spi_config
-	2000000,                       // spi_clk_hz
+	0,                             // cs_delay
+	SPI_ENGINE_CONFIG_CPHA,        // config
 	100000000,                     // ref_clk_hz
-	1,                             // spi_offload_rx_support_en
-	AD7134_DMA_BASEADDR,           // spi_offload_rx_dma_baseaddr
-	1,                             // spi_offload_tx_support_en
-	AD7134_DMA_BASEADDR,           // spi_offload_tx_dma_baseaddr
+	2000000,                       // spi_clk_hz
+};
+
+struct axi_dmac_init ad713x_dmac_init = {
+	"ad713x_dmac",
+	AD7134_DMA_BASEADDR,
+	DMA_DEV_TO_MEM,
+	0,
+	false
 };
 
 ad713x_init_param ad713x_default_init_param = {
@@ -151,53 +162,76 @@ ad713x_init_param ad713x_default_init_param = {
 int main()
 {
 	ad713x_dev *dev;
-	spi_eng_desc *desc;
+	struct spi_engine_desc *desc;
+	struct spi_engine_program prog;
+	struct axi_dmac *dmac;
+	struct spi_engine_stream_init stream_init;
+	struct spi_engine_stream *stream;
+	struct axi_dmac_stream_buf *bufs[AD7134_OFFLOAD_BUFFERS];
 	uint32_t *offload_data;
-	spi_eng_msg *msg;
-	uint32_t i;
-	uint32_t spi_eng_msg_cmds[2];
-
-	spi_eng_msg_cmds[0] = SLEEP(2000); // 2us
-	spi_eng_msg_cmds[1] = TRANSFER_BYTES_R(3);
+	uint32_t i, n;
+	int32_t ret;
 
 	Xil_ICacheEnable();
 	Xil_DCacheEnable();
 
 	ad713x_init(&dev, ad713x_default_init_param);
 
-	spi_eng_init(&desc, spi_eng_init_params);
+	ret = spi_engine_init(&desc, &spi_eng_init_params);
+	if (ret < 0)
+		return ret;
 
 	ad713x_dig_filter_sel_ch(dev, SINC3, CH0);
 
-	/* For this example, only offload is supported*/
-	msg = (spi_eng_msg *)malloc(sizeof(*msg));
-	if (!msg)
-		return -1;
-
-	msg->spi_msg_cmds = malloc(sizeof(spi_eng_msg_cmds));
-	msg->spi_msg_cmds = spi_eng_msg_cmds;
-	msg->msg_cmd_len = ARRAY_SIZE(spi_eng_msg_cmds);
-	msg->rx_buf_addr = 0x800000;
-	msg->tx_buf_addr = 0xA000000;
-
-	/* Init the rx buffer with 0s */
-	for (i = 0; i < ARRAY_SIZE(msg->rx_buf); i++)
-		msg->rx_buf[i] = 0;
-
-	spi_eng_offload_load_msg(desc, msg);
-	spi_eng_transfer_multiple_msgs(desc, 1024);
+	/* Wait 2us, then read the 24-bit sample */
+	spi_engine_program_init(desc, &prog);
+	spi_engine_program_sleep(desc, &prog, 2000);
+	spi_engine_program_transfer(&prog, NULL, true,
+				    DIV_ROUND_UP(24, desc->data_width));
+	ret = spi_engine_program_end(&prog);
+	if (ret < 0)
+		return ret;
 
-	mdelay(10000);
-
-	free(msg);
-
-	offload_data = (uint32_t*)desc->rx_dma_startaddr;
-	for(i = 0; i < (desc->rx_length/4); i++) {
-		printf("CH%lu: 0x%lx\r\n", i%8, *offload_data);
-		offload_data += 1; // go to the next address in memory
+	/* For this example, only offload is supported*/
+	ret = axi_dmac_init(&dmac, &ad713x_dmac_init);
+	if (ret < 0)
+		return ret;
+
+	stream_init.slot = AD7134_OFFLOAD_SLOT;
+	stream_init.prog = &prog;
+	stream_init.dmac = dmac;
+	stream_init.ring.address = AD7134_OFFLOAD_RX_ADDR;
+	stream_init.ring.size = AD7134_OFFLOAD_SAMPLES * 4;
+	stream_init.ring.num_buffers = AD7134_OFFLOAD_BUFFERS;
+	stream_init.ring.filled = NULL;
+	stream_init.ring.ctx = NULL;
+	ret = spi_engine_stream_init(&stream, desc, &stream_init);
+	if (ret < 0)
+		return ret;
+
+	/* Hold every buffer of the ring: one gap-free capture */
+	ret = spi_engine_stream_start(stream);
+	for (n = 0; (ret == 0) && (n < AD7134_OFFLOAD_BUFFERS); n++)
+		ret = spi_engine_stream_get(stream, &bufs[n], 10000);
+	spi_engine_stream_stop(stream);
+	if (ret < 0)
+		return ret;
+
+	for (n = 0; n < AD7134_OFFLOAD_BUFFERS; n++) {
+		Xil_DCacheInvalidateRange(bufs[n]->address, bufs[n]->size);
+		if (bufs[n]->gap || (bufs[n]->seq != bufs[0]->seq + n))
+			printf("Samples lost\r\n");
+		offload_data = (uint32_t*)bufs[n]->address;
+		for(i = 0; i < AD7134_OFFLOAD_SAMPLES; i++) {
+			printf("CH%lu: 0x%lx\r\n", i%8, *offload_data);
+			offload_data += 1; // go to the next address in memory
+		}
+		spi_engine_stream_release(stream, bufs[n]);
 	}
 
-	spi_eng_remove(desc);
+	spi_engine_stream_remove(stream);
+	axi_dmac_remove(dmac);
+	spi_engine_remove(desc);
 	ad713x_remove(dev);
 	print("Bye\n\r");
 
@@ -0,0 +1,29 @@
+## NOOS-DIR:
+##		is the no-OS root variable (do not override)
+##
+## M_INC_DIRS:
+##		list all your include folders (all *.h and *.c files from these folders are included
+##		in compile and passed as directives)
+##
+## M_HDR_FILES:
+##		if you want to hand pick files, use this variable to list header files.
+##
+## M_SRC_FILES:
+##		if you want to hand pick files, use this variable to list source files.
+
+M_INC_DIRS := $(NOOS-DIR)/drivers/axi_core/spi_engine
+M_INC_DIRS += $(NOOS-DIR)/drivers/axi_core/axi_dmac
+M_INC_DIRS += $(NOOS-DIR)/ad713x-fmcz
+
+M_HDR_FILES := $(NOOS-DIR)/include/axi_io.h
+M_HDR_FILES += $(NOOS-DIR)/include/delay.h
+M_HDR_FILES += $(NOOS-DIR)/include/error.h
+M_HDR_FILES += $(NOOS-DIR)/include/util.h
+M_HDR_FILES += $(NOOS-DIR)/include/timer.h
+M_HDR_FILES += $(NOOS-DIR)/include/poll_timeout.h
+
+M_SRC_FILES := $(NOOS-DIR)/drivers/platform/xilinx/axi_io.c
+M_SRC_FILES += $(NOOS-DIR)/drivers/platform/xilinx/delay.c
+M_SRC_FILES += $(NOOS-DIR)/drivers/platform/xilinx/timer.c
+M_SRC_FILES += $(NOOS-DIR)/util/util.c
+M_SRC_FILES += $(NOOS-DIR)/util/poll_timeout.c
@@ -43,7 +43,6 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <sleep.h>
 #include "platform_drivers.h"
 
 /******************************************************************************/
@@ -190,13 +189,3 @@ int32_t gpio_set_value(gpio_desc *desc,
 	return 0;
 }
 
-/**
- * @brief Generate miliseconds delay.
- * @param msecs - Delay in miliseconds.
- * @return None.
- */
-void mdelay(uint32_t msecs)
-{
-	usleep(msecs * 1000);
-}
-
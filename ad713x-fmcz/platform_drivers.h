@@ -41,7 +41,8 @@
 #define PLATFORM_DRIVERS_H_
 #include <xgpiops.h>
 #include <xspips.h>
-#include "spi_engine.h"
+#include "util.h"
+#include "delay.h"
 
 /******************************************************************************/
 /********************** Macros and Constants Definitions **********************/
@@ -157,8 +158,5 @@ int32_t gpio_remove(gpio_desc *desc);
 int32_t gpio_set_value(gpio_desc *desc,
 		       uint8_t value);
 
-/* Generate miliseconds delay. */
-void mdelay(uint32_t msecs);
-
 #endif // PLATFORM_DRIVERS_H_
 
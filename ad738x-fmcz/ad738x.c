@@ -44,6 +44,7 @@
 #include "stdlib.h"
 #include "stdbool.h"
 #include "spi_engine.h"
+#include "delay.h"
 #include "ad738x.h"
 
 /******************************************************************************/
@@ -66,7 +67,7 @@ int32_t ad738x_spi_reg_read(ad738x_dev *dev,
 	buf[0] = AD738X_REG_READ(reg_addr);
 	buf[1] = 0x00;
 
-	ret = spi_write_and_read(dev->spi_desc, buf, 2);
+	ret = spi_engine_write_and_read(dev->spi_desc, buf, 2);
 	*reg_data = (buf[0] << 8) | buf[1];
 
 	return ret;
@@ -89,7 +90,7 @@ int32_t ad738x_spi_reg_write(ad738x_dev *dev,
 	buf[0] = AD738X_REG_WRITE(reg_addr) | ((reg_data & 0xF00) >> 8);
 	buf[1] = reg_data & 0xFFF;
 
-	ret = spi_write_and_read(dev->spi_desc, buf, 2);
+	ret = spi_engine_write_and_read(dev->spi_desc, buf, 2);
 
 	return ret;
 }
@@ -138,7 +139,7 @@ int32_t ad738x_spi_single_conversion(ad738x_dev *dev,
 
 	/* Conversion data is 2 bytes long */
 	rx_buf_len = 2 * dev->conv_mode + 2;
-	ret = spi_write_and_read(dev->spi_desc, buf, rx_buf_len);
+	ret = spi_engine_write_and_read(dev->spi_desc, buf, rx_buf_len);
 
 	/*
 	 *  Conversion data is 16 bits long in 1-wire mode and
@@ -301,7 +302,14 @@ int32_t ad738x_init(ad738x_dev **device,
 	if (!dev)
 		return -1;
 
-	ret = spi_init(&dev->spi_desc, init_param.spi_init);
+	ret = spi_engine_init(&dev->spi_desc, &init_param.spi_init);
+	if (ret < 0) {
+		free(dev);
+		return ret;
+	}
+
+	/* Registers are accessed and conversions read in 16-bit words */
+	ret = spi_engine_set_transfer_width(dev->spi_desc, 16);
 
 	ret |= ad738x_reset(dev, HARD_RESET);
 	mdelay(1000);
@@ -328,7 +336,7 @@ int32_t ad738x_remove(ad738x_dev *dev)
 {
 	int32_t ret;
 
-	ret = spi_remove(dev->spi_desc);
+	ret = spi_engine_remove(dev->spi_desc);
 
 	free(dev);
 
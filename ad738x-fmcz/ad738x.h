@@ -43,13 +43,6 @@
 /******************************************************************************/
 /********************** Macros and Constants Definitions **********************/
 /******************************************************************************/
-/*
- * Create a contiguous bitmask starting at bit position @l and ending at
- * position @h.
- */
-#define GENMASK(h, l) \
-		(((~0UL) - (1UL << (l)) + 1) & (~0UL >> (31 - (h))))
-
 /*
  * AD738X registers definition
  */
@@ -107,9 +100,6 @@
 /* Read from register x */
 #define AD738X_REG_READ(x)              ((x & 0x7) << 4)
 
-/* Size of an array in bytes */
-#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
-
 /*****************************************************************************/
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
@@ -154,7 +144,7 @@ typedef enum {
 
 typedef struct {
 	/* SPI */
-	spi_desc		*spi_desc;
+	struct spi_engine_desc	*spi_desc;
 	/* Device Settings */
 	ad738x_conv_mode 	conv_mode;
 	ad738x_resolution 	resolution;
@@ -162,7 +152,7 @@ typedef struct {
 
 typedef struct {
 	/* SPI */
-	spi_init_param		spi_init;
+	struct spi_engine_init_param	spi_init;
 	/* Device Settings */
 	ad738x_conv_mode	conv_mode;
 	ad738x_ref_sel		ref_sel;
@@ -198,5 +188,4 @@ int32_t ad738x_power_down_mode(ad738x_dev *dev,
 			       ad738x_pwd_mode pmode);
 int32_t ad738x_reference_sel(ad738x_dev *dev,
 			     ad738x_ref_sel ref_sel);
-void mdelay(uint32_t msecs);
 #endif /* SRC_AD738X_H_ */
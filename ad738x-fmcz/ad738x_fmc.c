@@ -49,6 +49,7 @@
 #include <xparameters.h>
 #include "xil_printf.h"
 #include "spi_engine.h"
+#include "axi_dmac.h"
 #include "ad738x.h"
 
 /******************************************************************************/
@@ -58,33 +59,34 @@
 #define AD738X_SPI_ENGINE_BASEADDR      XPAR_SPI_AXI_BASEADDR
 #define AD738X_SPI_CS                   0
 
+#define AD738X_OFFLOAD_SLOT		0
+#define AD738X_OFFLOAD_RX_ADDR		0x800000
+#define AD738X_OFFLOAD_BUFFERS		4
+/* Samples per buffer, one 16-bit word each */
+#define AD738X_OFFLOAD_SAMPLES		64
+
 ad738x_init_param ad738x_default_init_param = {
 	/* SPI engine*/
 	{
-		AD738X_SPI_ENGINE_BASEADDR, // adc_baseaddr
+		AD738X_SPI_ENGINE_BASEADDR, // base
 		AD738X_SPI_CS,              // chip_select
-		SPI_ENGINE_CONFIG_CPOL,     // spi_config
-		1000000,                    // spi_clk_hz
+		0,                          // cs_delay
+		SPI_ENGINE_CONFIG_CPOL,     // config
 		100000000,                  // ref_clk_hz
-		1,                          // spi_offload_rx_support_en
-		AD738X_DMA_BASEADDR,        // spi_offload_rx_dma_baseaddr
-		1,                          // spi_offload_tx_support_en
-		AD738X_DMA_BASEADDR         // spi_offload_tx_dma_baseaddr
+		1000000                     // spi_clk_hz
 	},
 	/* Configuration */
 	ONE_WIRE_MODE,		// conv_mode
 	INT_REF,		// ref_sel
 };
 
-/**
- * @brief Generate miliseconds delay.
- * @param msecs - Delay in miliseconds.
- * @return None.
- */
-void mdelay(uint32_t msecs)
-{
-	usleep(msecs * 1000);
-}
+struct axi_dmac_init ad738x_dmac_init = {
+	"ad738x_dmac",
+	AD738X_DMA_BASEADDR,
+	DMA_DEV_TO_MEM,
+	0,
+	false
+};
 
 #define SPI_ENGINE_OFFLOAD_EXAMPLE	0
 
@@ -93,11 +95,14 @@ int main()
 	ad738x_dev *dev;
 	uint16_t adc_data[2];
 	uint16_t *offload_data;
-	spi_eng_msg *msg;
-	int i;
-	uint32_t spi_eng_msg_cmds[6] = {CS_DEASSERT, TRANSFER_BYTES_W(2), CS_ASSERT,
-					CS_DEASSERT, TRANSFER_BYTES_R(2), CS_ASSERT
-				       };
+	struct spi_engine_program prog;
+	struct axi_dmac *dmac;
+	struct spi_engine_stream_init stream_init;
+	struct spi_engine_stream *stream;
+	struct axi_dmac_stream_buf *bufs[AD738X_OFFLOAD_BUFFERS];
+	uint32_t tx = 0x00;
+	int32_t ret;
+	int i, n;
 
 	Xil_ICacheEnable();
 	Xil_DCacheEnable();
@@ -114,34 +119,59 @@ int main()
 	}
 	/* Offload example */
 	else {
-		msg = (spi_eng_msg *)malloc(sizeof(*msg));
-		if (!msg)
-			return -1;
-
-		msg->spi_msg_cmds = malloc(sizeof(spi_eng_msg_cmds));
-		msg->spi_msg_cmds = spi_eng_msg_cmds;
-		msg->msg_cmd_len = ARRAY_SIZE(spi_eng_msg_cmds);
-		msg->rx_buf_addr = 0x800000;
-		msg->tx_buf_addr = 0xA000000;
-		msg->tx_buf[0] = 0x00;
-
-		/* Init the rx buffer with 0s */
-		for (i = 0; i < ARRAY_SIZE(msg->rx_buf); i++)
-			msg->rx_buf[i] = 0;
-
-		spi_eng_offload_load_msg(dev->spi_desc, msg);
-		spi_eng_transfer_multiple_msgs(dev->spi_desc, 256);
-
-		mdelay(10000);
-
-		free(msg);
-
-		offload_data = (uint16_t*)dev->spi_desc->rx_dma_startaddr;
-		/* Data for ADC0 and ADC1 is interleaved */
-		for(i = 0; i < dev->spi_desc->rx_length / 2; i++) {
-			printf("ADC%d: %d\r\n", (i % 2), *offload_data);
-			offload_data += sizeof(uint8_t);
+		/* A NOP write frame, then a 16-bit read frame */
+		spi_engine_program_init(dev->spi_desc, &prog);
+		spi_engine_program_cs(dev->spi_desc, &prog, true);
+		spi_engine_program_transfer(&prog, &tx, false, 1);
+		spi_engine_program_cs(dev->spi_desc, &prog, false);
+		spi_engine_program_cs(dev->spi_desc, &prog, true);
+		spi_engine_program_transfer(&prog, NULL, true, 1);
+		spi_engine_program_cs(dev->spi_desc, &prog, false);
+		ret = spi_engine_program_end(&prog);
+		if (ret < 0)
+			return ret;
+
+		ret = axi_dmac_init(&dmac, &ad738x_dmac_init);
+		if (ret < 0)
+			return ret;
+
+		stream_init.slot = AD738X_OFFLOAD_SLOT;
+		stream_init.prog = &prog;
+		stream_init.dmac = dmac;
+		stream_init.ring.address = AD738X_OFFLOAD_RX_ADDR;
+		stream_init.ring.size = AD738X_OFFLOAD_SAMPLES * 2;
+		stream_init.ring.num_buffers = AD738X_OFFLOAD_BUFFERS;
+		stream_init.ring.filled = NULL;
+		stream_init.ring.ctx = NULL;
+		ret = spi_engine_stream_init(&stream, dev->spi_desc,
+					     &stream_init);
+		if (ret < 0)
+			return ret;
+
+		/* Hold every buffer of the ring: one gap-free capture */
+		ret = spi_engine_stream_start(stream);
+		for (n = 0; (ret == 0) && (n < AD738X_OFFLOAD_BUFFERS); n++)
+			ret = spi_engine_stream_get(stream, &bufs[n], 10000);
+		spi_engine_stream_stop(stream);
+		if (ret < 0)
+			return ret;
+
+		for (n = 0; n < AD738X_OFFLOAD_BUFFERS; n++) {
+			Xil_DCacheInvalidateRange(bufs[n]->address,
+						  bufs[n]->size);
+			if (bufs[n]->gap || (bufs[n]->seq != bufs[0]->seq + n))
+				printf("Samples lost\r\n");
+			offload_data = (uint16_t*)bufs[n]->address;
+			/* Data for ADC0 and ADC1 is interleaved */
+			for(i = 0; i < AD738X_OFFLOAD_SAMPLES; i++) {
+				printf("ADC%d: %d\r\n", (i % 2), *offload_data);
+				offload_data += sizeof(uint8_t);
+			}
+			spi_engine_stream_release(stream, bufs[n]);
 		}
+
+		spi_engine_stream_remove(stream);
+		axi_dmac_remove(dmac);
 	}
 
 	ad738x_remove(dev);
@@ -408,8 +408,10 @@ int32_t ad7616_setup(ad7616_dev **device,
 	dev->spi_dev.mode = init_param.spi_mode;
 	dev->spi_dev.device_id = init_param.spi_device_id;
 	dev->spi_dev.type = init_param.spi_type;
+	dev->spi_dev.engine_desc = NULL;
 	if (dev->interface == AD7616_SERIAL)
 		ret |= spi_init(&dev->spi_dev);
+	dev->core->spi_desc = dev->spi_dev.engine_desc;
 
 	dev->gpio_dev.device_id = init_param.gpio_device_id;
 	dev->gpio_dev.type = init_param.gpio_type;
@@ -48,6 +48,12 @@
 #include "platform_drivers.h"
 #include "spi_engine.h"
 
+/******************************************************************************/
+/************************ Variables Definitions *******************************/
+/******************************************************************************/
+/* Serial conversion readout, run by the SPI Engine offload */
+static struct spi_engine_program ad7616_serial_prog;
+
 /***************************************************************************//**
 * @brief ad7616_core_read
 *******************************************************************************/
@@ -127,22 +133,37 @@ int32_t ad7616_capture_serial(adc_core core,
 							  uint32_t no_of_samples,
 							  uint32_t start_address)
 {
+	struct spi_engine_desc *spi = core.spi_desc;
 	uint32_t reg_val;
 	uint32_t transfer_id;
 	uint32_t length;
-
-	mdelay(10);
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CTRL(0), 0x0);
-	mdelay(10);
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_RESET(0), 0x1);
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_SDO_MEM(0), 0x00);
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0), 0x2103);
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0), 0x2000);
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0), 0x11fe);
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0), 0x0201);
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0), 0x3000);
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CMD_MEM(0), 0x11ff);
-	spi_engine_write(SPI_ENGINE_REG_OFFLOAD_CTRL(0), 0x1);
+	uint32_t clk_div;
+	uint8_t config;
+	int32_t ret;
+
+	if (!spi)
+		return -1;
+
+	/* Each conversion is read in two words, in SPI mode 3 at the full
+	 * reference clock. The register accesses keep their own settings. */
+	config = spi->config;
+	clk_div = spi->clk_div;
+	spi->config = SPI_ENGINE_CONFIG_CPOL | SPI_ENGINE_CONFIG_CPHA;
+	spi_engine_set_speed(spi, spi->ref_clk_hz / 2);
+	spi_engine_program_init(spi, &ad7616_serial_prog);
+	spi_engine_program_cs(spi, &ad7616_serial_prog, true);
+	spi_engine_program_transfer(&ad7616_serial_prog, NULL, true, 2);
+	spi_engine_program_cs(spi, &ad7616_serial_prog, false);
+	ret = spi_engine_program_end(&ad7616_serial_prog);
+	spi->config = config;
+	spi->clk_div = clk_div;
+	if (ret < 0)
+		return ret;
+
+	ret = spi_engine_offload_load(spi, 0, &ad7616_serial_prog);
+	if (ret < 0)
+		return ret;
+	spi_engine_offload_enable(spi, 0, true);
 
 	ad7616_core_write(core, AD7616_REG_UP_CTRL,
 								AD7616_CTRL_RESETN | AD7616_CTRL_CNVST_EN);
@@ -181,6 +202,7 @@ int32_t ad7616_capture_serial(adc_core core,
 	} while ((reg_val & (1 << transfer_id)) != (1 << transfer_id));
 
 	ad7616_core_write(core, AD7616_REG_UP_CTRL, AD7616_CTRL_RESETN);
+	spi_engine_offload_enable(spi, 0, false);
 
 	return 0;
 }
@@ -92,6 +92,8 @@ typedef struct {
 	uint32_t	dmac_baseaddr;
 	uint8_t		no_of_channels;
 	uint8_t		resolution;
+	/* SPI Engine of the serial interface */
+	struct spi_engine_desc	*spi_desc;
 } adc_core;
 
 /******************************************************************************/
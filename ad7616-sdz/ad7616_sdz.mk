@@ -11,9 +11,19 @@
 ## M_SRC_FILES:
 ##		if you want to hand pick files, use this variable to list source files.
 
+M_INC_DIRS := $(NOOS-DIR)/drivers/axi_core/spi_engine
+M_INC_DIRS += $(NOOS-DIR)/drivers/axi_core/axi_dmac
 M_INC_DIRS += $(NOOS-DIR)/ad7616-sdz
 
-M_HDR_FILES :=
-
-M_SRC_FILES :=
+M_HDR_FILES := $(NOOS-DIR)/include/axi_io.h
+M_HDR_FILES += $(NOOS-DIR)/include/delay.h
+M_HDR_FILES += $(NOOS-DIR)/include/error.h
+M_HDR_FILES += $(NOOS-DIR)/include/util.h
+M_HDR_FILES += $(NOOS-DIR)/include/timer.h
+M_HDR_FILES += $(NOOS-DIR)/include/poll_timeout.h
 
+M_SRC_FILES := $(NOOS-DIR)/drivers/platform/xilinx/axi_io.c
+M_SRC_FILES += $(NOOS-DIR)/drivers/platform/xilinx/delay.c
+M_SRC_FILES += $(NOOS-DIR)/drivers/platform/xilinx/timer.c
+M_SRC_FILES += $(NOOS-DIR)/util/util.c
+M_SRC_FILES += $(NOOS-DIR)/util/poll_timeout.c
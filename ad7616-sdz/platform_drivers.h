@@ -56,18 +56,13 @@
 #ifdef XPAR_PS7_SPI_0_DEVICE_ID
 #include <xspips.h>
 #endif
+#include "util.h"
+#include "delay.h"
+#include "spi_engine.h"
 
 /******************************************************************************/
 /********************** Macros and Constants Definitions **********************/
 /******************************************************************************/
-#define min(x, y) (((x) < (y)) ? (x) : (y))
-#define min_t(type, x, y) (type)min((type)(x), (type)(y))
-#define max(x, y) (((x) > (y)) ? (x) : (y))
-#define max_t(type, x, y) (type)max((type)(x), (type)(y))
-#define clamp(val, min_val, max_val) (max(min((val), (max_val)), (min_val)))
-#define clamp_t(type, val, min_val, max_val) (type)clamp((type)(val), \
-											 (type)(min_val), (type)(max_val))
-
 #define GPIO_OUT		1
 #define GPIO_IN			0
 #define GPIO_HIGH		1
@@ -123,6 +118,7 @@ typedef struct {
 	XSpiPs_Config	*ps7_config;
 	XSpiPs			ps7_instance;
 #endif
+	struct spi_engine_desc	*engine_desc;
 } spi_device;
 
 /******************************************************************************/
@@ -142,6 +138,4 @@ int32_t gpio_set_value(gpio_device *dev,
 int32_t gpio_get_value(gpio_device *dev,
 					   uint8_t pin,
 					   uint8_t *data);
-void mdelay(uint32_t msecs);
-uint64_t do_div(uint64_t* n, uint64_t base);
 #endif
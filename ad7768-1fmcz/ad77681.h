@@ -311,7 +311,7 @@ enum ad77681_crc_sel {
 
 struct ad77681_dev {
 	/* SPI */
-	spi_desc			*spi_desc;
+	struct spi_engine_desc		*spi_desc;
 	/* Configuration */
 	enum ad77681_power_mode		power_mode;
 	enum ad77681_mclk_div		mclk_div;
@@ -325,7 +325,7 @@ struct ad77681_dev {
 
 struct ad77681_init_param {
 	/* SPI */
-	spi_init_param			spi_eng_dev_init;
+	struct spi_engine_init_param	spi_eng_dev_init;
 	/* Configuration */
 	enum ad77681_power_mode		power_mode;
 	enum ad77681_mclk_div		mclk_div;
@@ -50,6 +50,8 @@
 #include "xil_printf.h"
 #include "ad77681.h"
 #include "spi_engine.h"
+#include "axi_dmac.h"
+#include "delay.h"
 
 /******************************************************************************/
 /********************** Macros and Constants Definitions **********************/
@@ -79,23 +81,22 @@
 #define GPIO_1_SYNC_OUT						GPIO_OFFSET + 17 // 49
 #define GPIO_1_RESET						GPIO_OFFSET + 16 // 48
 
-uint32_t spi_msg_cmds[6] = {CS_DEASSERT, CS_ASSERT, CS_DEASSERT, TRANSFER_BYTES_W(2), TRANSFER_BYTES_R(4), CS_ASSERT};
+#define AD77681_OFFLOAD_SLOT				0
+#define AD77681_OFFLOAD_RX_ADDR				0x800000
+#define AD77681_OFFLOAD_BUFFERS				2
+/* Samples per buffer */
+#define AD77681_OFFLOAD_SAMPLES				4
 
 struct ad77681_init_param ADC_default_init_param = {
 	/* SPI */
 	{
-		AD77681_SPI1_ENGINE_BASEADDR,	// adc_baseaddr
+		AD77681_SPI1_ENGINE_BASEADDR,	// base
 		AD77681_SPI_CS,			// chip_select
 		1,				// cs_delay
 		SPI_ENGINE_CONFIG_CPOL |
-		SPI_ENGINE_CONFIG_CPHA,		// spi_config
-		1000000,			// spi_clk_hz
-		1000000,			// spi_clk_hz_reg_access
+		SPI_ENGINE_CONFIG_CPHA,		// config
 		100000000,			// ref_clk_hz
-		1,				// spi_offload_rx_support_en
-		AD77681_DMA_1_BASEADDR,		// spi_offload_rx_dma_baseaddr
-		1,				// spi_offload_tx_support_en
-		AD77681_DMA_1_BASEADDR,		// spi_offload_tx_dma_baseaddr
+		1000000,			// spi_clk_hz
 	},
 	/* Configuration */
 	AD77681_FAST,				// power_mode
@@ -108,25 +109,29 @@ struct ad77681_init_param ADC_default_init_param = {
 	0 							// status_bit
 };
 
-/**
- * @brief Generate miliseconds delay.
- * @param msecs - Delay in miliseconds.
- * @return None.
- */
-void mdelay(uint32_t msecs)
-{
-	usleep(msecs * 1000);
-}
+struct axi_dmac_init ad77681_dmac_init = {
+	"ad77681_dmac",
+	AD77681_DMA_1_BASEADDR,
+	DMA_DEV_TO_MEM,
+	0,
+	false
+};
 
 #define SPI_ENGINE_OFFLOAD_EXAMPLE	0
 
 int main()
 {
 	struct ad77681_dev	*adc_dev;
-	spi_eng_msg 		*msg;
+	struct spi_engine_program prog;
+	struct axi_dmac		*dmac;
+	struct spi_engine_stream_init stream_init;
+	struct spi_engine_stream *stream;
+	struct axi_dmac_stream_buf *bufs[AD77681_OFFLOAD_BUFFERS];
+	uint32_t		tx[2];
 	uint8_t			adc_data[5];
 	uint8_t 		*data;
-	uint32_t 		i;
+	uint32_t 		i, n;
+	int32_t			ret;
 
 	Xil_ICacheEnable();
 	Xil_DCacheEnable();
@@ -144,30 +149,62 @@ int main()
 			mdelay(1000);
 		}
 	} else { // offload example
-		msg = (spi_eng_msg *)malloc(sizeof(*msg));
-		if (!msg)
-			return -1;
-
-		msg->spi_msg_cmds = malloc(sizeof(spi_msg_cmds));
-		msg->spi_msg_cmds = spi_msg_cmds;
-		msg->rx_buf_addr = 0x800000;
-		msg->tx_buf_addr = 0xA000000;
-		msg->msg_cmd_len = sizeof(spi_msg_cmds) / sizeof(uint32_t);
-		msg->tx_buf[0] = AD77681_REG_READ(AD77681_REG_ADC_DATA);
-		msg->tx_buf[1] = 0x00;
-
-		spi_eng_offload_load_msg(adc_dev->spi_desc, msg);
-		spi_eng_transfer_multiple_msgs(adc_dev->spi_desc, 8);
-
-		data = (uint8_t*)adc_dev->spi_desc->rx_dma_startaddr;
-
-		mdelay(10000);
-
-		for(i = 0; i < adc_dev->spi_desc->rx_length; i++) {
-			printf("%x\r\n", *data);
-			data += sizeof(uint8_t);
+		tx[0] = AD77681_REG_READ(AD77681_REG_ADC_DATA);
+		tx[1] = 0x00;
+
+		spi_engine_program_init(adc_dev->spi_desc, &prog);
+		spi_engine_program_cs(adc_dev->spi_desc, &prog, true);
+		spi_engine_program_cs(adc_dev->spi_desc, &prog, false);
+		spi_engine_program_cs(adc_dev->spi_desc, &prog, true);
+		spi_engine_program_transfer(&prog, tx, false, 2);
+		spi_engine_program_transfer(&prog, NULL, true, 4);
+		spi_engine_program_cs(adc_dev->spi_desc, &prog, false);
+		ret = spi_engine_program_end(&prog);
+		if (ret < 0)
+			return ret;
+
+		ret = axi_dmac_init(&dmac, &ad77681_dmac_init);
+		if (ret < 0)
+			return ret;
+
+		stream_init.slot = AD77681_OFFLOAD_SLOT;
+		stream_init.prog = &prog;
+		stream_init.dmac = dmac;
+		stream_init.ring.address = AD77681_OFFLOAD_RX_ADDR;
+		/* One 32-bit DMA word per SDI word */
+		stream_init.ring.size = AD77681_OFFLOAD_SAMPLES *
+					prog.sdi_len * 4;
+		stream_init.ring.num_buffers = AD77681_OFFLOAD_BUFFERS;
+		stream_init.ring.filled = NULL;
+		stream_init.ring.ctx = NULL;
+		ret = spi_engine_stream_init(&stream, adc_dev->spi_desc,
+					     &stream_init);
+		if (ret < 0)
+			return ret;
+
+		/* Hold every buffer of the ring: one gap-free capture */
+		ret = spi_engine_stream_start(stream);
+		for (n = 0; (ret == 0) && (n < AD77681_OFFLOAD_BUFFERS); n++)
+			ret = spi_engine_stream_get(stream, &bufs[n], 10000);
+		spi_engine_stream_stop(stream);
+		if (ret < 0)
+			return ret;
+
+		for (n = 0; n < AD77681_OFFLOAD_BUFFERS; n++) {
+			Xil_DCacheInvalidateRange(bufs[n]->address,
+						  bufs[n]->size);
+			if (bufs[n]->gap || (bufs[n]->seq != bufs[0]->seq + n))
+				printf("Samples lost\r\n");
+			data = (uint8_t*)bufs[n]->address;
+			for(i = 0; i < bufs[n]->size; i++) {
+				printf("%x\r\n", *data);
+				data += sizeof(uint8_t);
+			}
+			spi_engine_stream_release(stream, bufs[n]);
 		}
-		free(msg);
+
+		spi_engine_stream_remove(stream);
+		axi_dmac_remove(dmac);
 	}
 
 	printf("Bye\n");
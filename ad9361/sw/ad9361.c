@@ -684,6 +684,170 @@ const char *ad9361_ensm_states[] = {
 	"rx", "rx_flush", "fdd", "fdd_flush"
 };
 
+/* Registers updated by the device itself, never served from the cache. */
+static const struct {
+	uint16_t	start;
+	uint16_t	end;
+} ad9361_volatile_regs[] = {
+	{REG_SPI_CONF, REG_SPI_CONF},
+	{REG_START_TEMP_READING, REG_TEMPERATURE},
+	{REG_CALIBRATION_CTRL, REG_STATE},
+	{REG_AUXADC_WORD_MSB, REG_AUXADC_LSB},
+	{REG_PRODUCT_ID, REG_PRODUCT_ID},
+	{REG_CH_1_OVERFLOW, REG_CH_2_OVERFLOW},
+	{REG_TX_FILTER_COEF_READ_DATA_1, REG_TX_FILTER_COEF_READ_DATA_2},
+	{REG_TX_RSSI1, REG_TX_RSSI_LSB},
+	{REG_TX1_OUT_1_PHASE_CORR, REG_TX2_OUT_2_OFFSET_Q},
+	{REG_QUAD_CAL_STATUS_TX1, REG_QUAD_CAL_STATUS_TX2},
+	{REG_RX_FILTER_COEF_READ_DATA_1, REG_RX_FILTER_COEF_READ_DATA_2},
+	{REG_GAIN_TABLE_READ_DATA1, REG_GAIN_TABLE_READ_DATA3},
+	{REG_GM_SUB_TABLE_GAIN_READ, REG_GM_SUB_TABLE_CTRL_READ},
+	{REG_GAIN_ERROR_READ, REG_GAIN_ERROR_READ},
+	{REG_LNA_GAIN_DIFF_READ_BACK, REG_LNA_GAIN_DIFF_READ_BACK},
+	{REG_CH1_ADC_POWER, REG_CH2_RX_FILTER_POWER},
+	{REG_RX1_INPUT_A_PHASE_CORR, REG_RX2_INPUT_BC_I_OFFSET},
+	{REG_RX1_BB_DC_WORD_I_MSB, REG_RX_PATH_GAIN_LSB},
+	{REG_INPUT_A_MSBS, REG_INPUTS_BC_MSBS},
+	{REG_RX_BBF_R2346, REG_RX_BBF_C3_LSB},
+	{REG_RESET, REG_RESET},
+	{REG_RX_FORCE_ALC, REG_RX_VCO_OUTPUT},
+	{REG_RX_CAL_STATUS, REG_RX_CAL_STATUS},
+	{REG_RX_CP_OVERRANGE_VCO_LOCK, REG_RX_CP_OVERRANGE_VCO_LOCK},
+	{REG_RX_FAST_LOCK_PROGRAM_READ, REG_RX_FAST_LOCK_PROGRAM_READ},
+	{REG_TX_FORCE_ALC, REG_TX_VCO_OUTPUT},
+	{REG_TX_CAL_STATUS, REG_TX_CAL_STATUS},
+	{REG_TX_CP_OVERRANGE_VCO_LOCK, REG_TX_CP_OVERRANGE_VCO_LOCK},
+	{REG_DCXO_TEMPCO_READ, REG_DCXO_TEMPCO_READ},
+	{REG_DELTA_T_READ, REG_DELTA_T_READ},
+	{REG_TX_FAST_LOCK_PROGRAM_READ, REG_TX_FAST_LOCK_PROGRAM_READ},
+	{REG_GAIN_RX1, REG_OVRG_SIGS_RX2},
+};
+
+/* Register caches of the devices that have one enabled. */
+static struct ad9361_reg_cache *ad9361_reg_caches;
+
+/**
+ * Check if a register may be changed by the device.
+ * @param reg The register address.
+ * @return true if the register must always be read from the device.
+ */
+static bool ad9361_reg_is_volatile(uint32_t reg)
+{
+	uint32_t i;
+
+	for (i = 0; i < ARRAY_SIZE(ad9361_volatile_regs); i++)
+		if (reg >= ad9361_volatile_regs[i].start &&
+		    reg <= ad9361_volatile_regs[i].end)
+			return true;
+
+	return false;
+}
+
+/**
+ * Get the register cache of a device.
+ * @param spi
+ * @return The register cache or NULL if the device has none.
+ */
+static struct ad9361_reg_cache *ad9361_reg_cache_get(struct spi_device *spi)
+{
+	struct ad9361_reg_cache *cache;
+
+	for (cache = ad9361_reg_caches; cache; cache = cache->next)
+		if (cache->spi == spi)
+			return cache;
+
+	return NULL;
+}
+
+/**
+ * Read registers from the cache.
+ * @param cache The register cache.
+ * @param reg The address of the first register, the next ones are read from
+ * 	      decreasing addresses as the device does.
+ * @param rbuf The data buffer.
+ * @param num The number of registers.
+ * @return true if all the registers were in the cache.
+ */
+static bool ad9361_reg_cache_read(struct ad9361_reg_cache *cache,
+				  uint32_t reg, uint8_t *rbuf, uint32_t num)
+{
+	uint32_t i, addr;
+
+	for (i = 0; i < num; i++) {
+		addr = AD_ADDR(reg - i);
+		if (ad9361_reg_is_volatile(addr) ||
+		    !(cache->valid[addr / 8] & BIT(addr % 8)))
+			return false;
+	}
+
+	for (i = 0; i < num; i++)
+		rbuf[i] = cache->val[AD_ADDR(reg - i)];
+
+	return true;
+}
+
+/**
+ * Update the cache with the values read from or written to the device.
+ * @param cache The register cache.
+ * @param reg The address of the first register.
+ * @param buf The register values.
+ * @param num The number of registers.
+ */
+static void ad9361_reg_cache_fill(struct ad9361_reg_cache *cache,
+				  uint32_t reg, const uint8_t *buf, uint32_t num)
+{
+	uint32_t i, addr;
+
+	for (i = 0; i < num; i++) {
+		addr = AD_ADDR(reg - i);
+		if (ad9361_reg_is_volatile(addr))
+			continue;
+		cache->val[addr] = buf[i];
+		cache->valid[addr / 8] |= BIT(addr % 8);
+	}
+}
+
+/**
+ * Drop all the cached values, the device registers changed (reset).
+ * @param cache The register cache.
+ */
+static void ad9361_reg_cache_invalidate(struct ad9361_reg_cache *cache)
+{
+	memset(cache->valid, 0, sizeof(cache->valid));
+}
+
+/**
+ * SPI register write, bypassing the cache.
+ * @param spi
+ * @param reg The register address.
+ * @param val The value of the register.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+static int32_t __ad9361_spi_write(struct spi_device *spi,
+				  uint32_t reg, uint32_t val)
+{
+	uint8_t buf[3];
+	int32_t ret;
+	uint16_t cmd;
+
+	cmd = AD_WRITE | AD_CNT(1) | AD_ADDR(reg);
+	buf[0] = cmd >> 8;
+	buf[1] = cmd & 0xFF;
+	buf[2] = val;
+
+	ret = spi_write_then_read(spi, buf, 3, NULL, 0);
+	if (ret < 0) {
+		dev_err(&spi->dev, "Write Error %"PRId32, ret);
+		return ret;
+	}
+
+#ifdef _DEBUG
+	dev_dbg(&spi->dev, "%s: reg 0x%"PRIX32" val 0x%X", __func__, reg, buf[2]);
+#endif
+
+	return 0;
+}
+
 /**
  * SPI multiple bytes register read.
  * @param spi
@@ -695,6 +859,7 @@ const char *ad9361_ensm_states[] = {
 int32_t ad9361_spi_readm(struct spi_device *spi, uint32_t reg,
 			 uint8_t *rbuf, uint32_t num)
 {
+	struct ad9361_reg_cache *cache = ad9361_reg_cache_get(spi);
 	uint8_t buf[2];
 	int32_t ret;
 	uint16_t cmd;
@@ -702,6 +867,9 @@ int32_t ad9361_spi_readm(struct spi_device *spi, uint32_t reg,
 	if (num > MAX_MBYTE_SPI)
 		return -EINVAL;
 
+	if (cache && ad9361_reg_cache_read(cache, reg, rbuf, num))
+		return 0;
+
 	cmd = AD_READ | AD_CNT(num) | AD_ADDR(reg);
 	buf[0] = cmd >> 8;
 	buf[1] = cmd & 0xFF;
@@ -711,6 +879,9 @@ int32_t ad9361_spi_readm(struct spi_device *spi, uint32_t reg,
 		dev_err(&spi->dev, "Read Error %"PRId32, ret);
 		return ret;
 	}
+
+	if (cache)
+		ad9361_reg_cache_fill(cache, reg, rbuf, num);
 #ifdef _DEBUG
 	{
 		int32_t i;
@@ -788,24 +959,19 @@ static int32_t __ad9361_spi_readf(struct spi_device *spi, uint32_t reg,
 int32_t ad9361_spi_write(struct spi_device *spi,
 			 uint32_t reg, uint32_t val)
 {
-	uint8_t buf[3];
+	struct ad9361_reg_cache *cache = ad9361_reg_cache_get(spi);
+	uint8_t buf = val;
 	int32_t ret;
-	uint16_t cmd;
-
-	cmd = AD_WRITE | AD_CNT(1) | AD_ADDR(reg);
-	buf[0] = cmd >> 8;
-	buf[1] = cmd & 0xFF;
-	buf[2] = val;
 
-	ret = spi_write_then_read(spi, buf, 3, NULL, 0);
-	if (ret < 0) {
-		dev_err(&spi->dev, "Write Error %"PRId32, ret);
+	ret = __ad9361_spi_write(spi, reg, val);
+	if (ret < 0 || !cache)
 		return ret;
-	}
 
-#ifdef _DEBUG
-	dev_dbg(&spi->dev, "%s: reg 0x%"PRIX32" val 0x%X", __func__, reg, buf[2]);
-#endif
+	/* Only cache what the device actually holds. */
+	if (AD_ADDR(reg) == REG_SPI_CONF)
+		ad9361_reg_cache_invalidate(cache);
+	else
+		ad9361_reg_cache_fill(cache, reg, &buf, 1);
 
 	return 0;
 }
@@ -860,6 +1026,7 @@ static int32_t __ad9361_spi_writef(struct spi_device *spi, uint32_t reg,
 static int32_t ad9361_spi_writem(struct spi_device *spi,
 				 uint32_t reg, uint8_t *tbuf, uint32_t num)
 {
+	struct ad9361_reg_cache *cache = ad9361_reg_cache_get(spi);
 	uint8_t buf[10];
 	int32_t ret;
 	uint16_t cmd;
@@ -884,6 +1051,9 @@ static int32_t ad9361_spi_writem(struct spi_device *spi,
 		return ret;
 	}
 
+	if (cache)
+		ad9361_reg_cache_fill(cache, reg, tbuf, num);
+
 #ifdef _DEBUG
 	{
 		int32_t i;
@@ -895,6 +1065,133 @@ static int32_t ad9361_spi_writem(struct spi_device *spi,
 	return 0;
 }
 
+/**
+ * SPI register write queue.
+ * The write is only stored, it is sent to the device by the next
+ * ad9361_spi_queue_flush() call or when the queue is full. Each queued write
+ * keeps its own chip select frame, so the dummy writes used as delays by the
+ * table loaders still work as before.
+ * @param phy The AD9361 state structure.
+ * @param reg The register address.
+ * @param val The value of the register.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_spi_queue_write(struct ad9361_rf_phy *phy,
+			       uint32_t reg, uint32_t val)
+{
+	uint8_t *buf;
+	int32_t ret;
+	uint16_t cmd;
+
+	if (phy->spi_queue_len == AD9361_SPI_QUEUE_SIZE) {
+		ret = ad9361_spi_queue_flush(phy);
+		if (ret < 0)
+			return ret;
+	}
+
+	cmd = AD_WRITE | AD_CNT(1) | AD_ADDR(reg);
+	buf = &phy->spi_queue[phy->spi_queue_len * 3];
+	buf[0] = cmd >> 8;
+	buf[1] = cmd & 0xFF;
+	buf[2] = val;
+	phy->spi_queue_len++;
+
+	return 0;
+}
+
+/**
+ * Send the queued SPI register writes as a single message.
+ * @param phy The AD9361 state structure.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_spi_queue_flush(struct ad9361_rf_phy *phy)
+{
+	uint32_t num = phy->spi_queue_len;
+	uint32_t i;
+	int32_t ret;
+
+	if (!num)
+		return 0;
+
+	phy->spi_queue_len = 0;
+
+	ret = spi_write_msgs(phy->spi, phy->spi_queue, 3, num);
+	if (ret < 0) {
+		dev_err(&phy->spi->dev, "Write Error %"PRId32, ret);
+		return ret;
+	}
+
+	if (phy->reg_cache)
+		for (i = 0; i < num; i++)
+			ad9361_reg_cache_fill(phy->reg_cache,
+					      AD_ADDR((phy->spi_queue[i * 3] << 8) |
+						      phy->spi_queue[i * 3 + 1]),
+					      &phy->spi_queue[i * 3 + 2], 1);
+
+#ifdef _DEBUG
+	for (i = 0; i < num; i++)
+		dev_dbg(&phy->spi->dev, "%s: reg 0x%X val 0x%X", __func__,
+			AD_ADDR((phy->spi_queue[i * 3] << 8) |
+				phy->spi_queue[i * 3 + 1]),
+			phy->spi_queue[i * 3 + 2]);
+#endif
+
+	return 0;
+}
+
+/**
+ * Enable the register cache.
+ * Register values are kept in memory after the first read or write, so
+ * read-modify-write accesses only write to the device. Registers changed by
+ * the device (status, calibration results, RSSI, temperature...) are never
+ * cached.
+ * @param phy The AD9361 state structure.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_spi_cache_enable(struct ad9361_rf_phy *phy)
+{
+	struct ad9361_reg_cache *cache;
+
+	if (phy->reg_cache)
+		return 0;
+
+	cache = zmalloc(sizeof(*cache));
+	if (!cache)
+		return -ENOMEM;
+
+	cache->spi = phy->spi;
+	cache->next = ad9361_reg_caches;
+	ad9361_reg_caches = cache;
+	phy->reg_cache = cache;
+
+	return 0;
+}
+
+/**
+ * Disable the register cache and free its memory.
+ * @param phy The AD9361 state structure.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_spi_cache_disable(struct ad9361_rf_phy *phy)
+{
+	struct ad9361_reg_cache **p;
+
+	if (!phy->reg_cache)
+		return 0;
+
+	for (p = &ad9361_reg_caches; *p; p = &(*p)->next) {
+		if (*p == phy->reg_cache) {
+			*p = phy->reg_cache->next;
+			break;
+		}
+	}
+
+	free(phy->reg_cache);
+	phy->reg_cache = NULL;
+
+	return 0;
+}
+
 /**
  * Validate RF BW frequency.
  * @param phy The AD9361 state structure.
@@ -1001,6 +1298,9 @@ int32_t ad9361_1rx1tx_channel_map(struct ad9361_rf_phy *phy, bool tx,
  */
 int32_t ad9361_reset(struct ad9361_rf_phy *phy)
 {
+	if (phy->reg_cache)
+		ad9361_reg_cache_invalidate(phy->reg_cache);
+
 	if (gpio_is_valid(phy->pdata->gpio_resetb)) {
 		gpio_set_value(phy->pdata->gpio_resetb, 0);
 		mdelay(1);
@@ -1453,8 +1753,8 @@ static int32_t ad9361_load_gt(struct ad9361_rf_phy *phy, uint64_t freq,
 	lna = phy->pdata->elna_ctrl.elna_in_gaintable_all_index_en ?
 	      EXT_LNA_CTRL : 0;
 
-	ad9361_spi_write(spi, REG_GAIN_TABLE_CONFIG, START_GAIN_TABLE_CLOCK |
-			 RECEIVER_SELECT(dest)); /* Start Gain Table Clock */
+	ad9361_spi_queue_write(phy, REG_GAIN_TABLE_CONFIG, START_GAIN_TABLE_CLOCK |
+			       RECEIVER_SELECT(dest)); /* Start Gain Table Clock */
 
 	/* TX QUAD Calibration */
 	if (phy->pdata->split_gt)
@@ -1465,34 +1765,38 @@ static int32_t ad9361_load_gt(struct ad9361_rf_phy *phy, uint64_t freq,
 	phy->tx_quad_lpf_tia_match = -EINVAL;
 
 	for (i = 0; i < index_max; i++) {
-		ad9361_spi_write(spi, REG_GAIN_TABLE_ADDRESS, i); /* Gain Table Index */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_WRITE_DATA1,
-				 tab[i][0] | lna); /* Ext LNA, Int LNA, & Mixer Gain Word */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_WRITE_DATA2,
-				 tab[i][1]); /* TIA & LPF Word */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_WRITE_DATA3,
-				 tab[i][2]); /* DC Cal bit & Dig Gain Word */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_CONFIG,
-				 START_GAIN_TABLE_CLOCK |
-				 WRITE_GAIN_TABLE |
-				 RECEIVER_SELECT(dest)); /* Gain Table Index */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_READ_DATA1,
-				 0); /* Dummy Write to delay 3 ADCCLK/16 cycles */
-		ad9361_spi_write(spi, REG_GAIN_TABLE_READ_DATA1,
-				 0); /* Dummy Write to delay ~1u */
+		ad9361_spi_queue_write(phy, REG_GAIN_TABLE_ADDRESS, i); /* Gain Table Index */
+		ad9361_spi_queue_write(phy, REG_GAIN_TABLE_WRITE_DATA1,
+				       tab[i][0] | lna); /* Ext LNA, Int LNA, & Mixer Gain Word */
+		ad9361_spi_queue_write(phy, REG_GAIN_TABLE_WRITE_DATA2,
+				       tab[i][1]); /* TIA & LPF Word */
+		ad9361_spi_queue_write(phy, REG_GAIN_TABLE_WRITE_DATA3,
+				       tab[i][2]); /* DC Cal bit & Dig Gain Word */
+		ad9361_spi_queue_write(phy, REG_GAIN_TABLE_CONFIG,
+				       START_GAIN_TABLE_CLOCK |
+				       WRITE_GAIN_TABLE |
+				       RECEIVER_SELECT(dest)); /* Gain Table Index */
+		ad9361_spi_queue_write(phy, REG_GAIN_TABLE_READ_DATA1,
+				       0); /* Dummy Write to delay 3 ADCCLK/16 cycles */
+		ad9361_spi_queue_write(phy, REG_GAIN_TABLE_READ_DATA1,
+				       0); /* Dummy Write to delay ~1u */
 
 		if ((tab[i][1] & lpf_tia_mask) == 0x20)
 			phy->tx_quad_lpf_tia_match = i;
 
 	}
 
-	ad9361_spi_write(spi, REG_GAIN_TABLE_CONFIG, START_GAIN_TABLE_CLOCK |
-			 RECEIVER_SELECT(dest)); /* Clear Write Bit */
-	ad9361_spi_write(spi, REG_GAIN_TABLE_READ_DATA1,
-			 0); /* Dummy Write to delay ~1u */
-	ad9361_spi_write(spi, REG_GAIN_TABLE_READ_DATA1,
-			 0); /* Dummy Write to delay ~1u */
-	ad9361_spi_write(spi, REG_GAIN_TABLE_CONFIG, 0); /* Stop Gain Table Clock */
+	ad9361_spi_queue_write(phy, REG_GAIN_TABLE_CONFIG, START_GAIN_TABLE_CLOCK |
+			       RECEIVER_SELECT(dest)); /* Clear Write Bit */
+	ad9361_spi_queue_write(phy, REG_GAIN_TABLE_READ_DATA1,
+			       0); /* Dummy Write to delay ~1u */
+	ad9361_spi_queue_write(phy, REG_GAIN_TABLE_READ_DATA1,
+			       0); /* Dummy Write to delay ~1u */
+	ad9361_spi_queue_write(phy, REG_GAIN_TABLE_CONFIG, 0); /* Stop Gain Table Clock */
+
+	ret = ad9361_spi_queue_flush(phy);
+	if (ret < 0)
+		return ret;
 
 	phy->current_table = band;
 
@@ -1562,31 +1866,31 @@ static int32_t ad9361_load_mixer_gm_subtable(struct ad9361_rf_phy *phy)
 	int32_t i, addr;
 	dev_dbg(&phy->spi->dev, "%s", __func__);
 
-	ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_CONFIG,
-			 START_GM_SUB_TABLE_CLOCK); /* Start Clock */
+	ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_CONFIG,
+			       START_GM_SUB_TABLE_CLOCK); /* Start Clock */
 
 	for (i = 0, addr = ARRAY_SIZE(gm_st_ctrl); i < (int64_t)ARRAY_SIZE(gm_st_ctrl);
 	     i++) {
-		ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_ADDRESS,
-				 --addr); /* Gain Table Index */
-		ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_BIAS_WRITE, 0); /* Bias */
-		ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_GAIN_WRITE,
-				 gm_st_gain[i]); /* Gain */
-		ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_CTRL_WRITE,
-				 gm_st_ctrl[i]); /* Control */
-		ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_CONFIG,
-				 WRITE_GM_SUB_TABLE | START_GM_SUB_TABLE_CLOCK); /* Write Words */
-		ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_GAIN_READ, 0); /* Dummy Delay */
-		ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_GAIN_READ, 0); /* Dummy Delay */
-	}
-
-	ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_CONFIG,
-			 START_GM_SUB_TABLE_CLOCK); /* Clear Write */
-	ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_GAIN_READ, 0); /* Dummy Delay */
-	ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_GAIN_READ, 0); /* Dummy Delay */
-	ad9361_spi_write(phy->spi, REG_GM_SUB_TABLE_CONFIG, 0); /* Stop Clock */
+		ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_ADDRESS,
+				       --addr); /* Gain Table Index */
+		ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_BIAS_WRITE, 0); /* Bias */
+		ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_GAIN_WRITE,
+				       gm_st_gain[i]); /* Gain */
+		ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_CTRL_WRITE,
+				       gm_st_ctrl[i]); /* Control */
+		ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_CONFIG,
+				       WRITE_GM_SUB_TABLE | START_GM_SUB_TABLE_CLOCK); /* Write Words */
+		ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_GAIN_READ, 0); /* Dummy Delay */
+		ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_GAIN_READ, 0); /* Dummy Delay */
+	}
 
-	return 0;
+	ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_CONFIG,
+			       START_GM_SUB_TABLE_CLOCK); /* Clear Write */
+	ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_GAIN_READ, 0); /* Dummy Delay */
+	ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_GAIN_READ, 0); /* Dummy Delay */
+	ad9361_spi_queue_write(phy, REG_GM_SUB_TABLE_CONFIG, 0); /* Stop Clock */
+
+	return ad9361_spi_queue_flush(phy);
 }
 
 /**
@@ -4906,7 +5210,6 @@ int32_t ad9361_fastlock_load(struct ad9361_rf_phy *phy, bool tx,
 {
 	uint32_t offs = 0;
 	int32_t i, ret = 0;
-	uint8_t buf[4];
 
 	dev_dbg(&phy->spi->dev, "%s: %s Profile %"PRIu32":",
 		__func__, tx ? "TX" : "RX", profile);
@@ -4914,21 +5217,25 @@ int32_t ad9361_fastlock_load(struct ad9361_rf_phy *phy, bool tx,
 	if (tx)
 		offs = REG_TX_FAST_LOCK_SETUP - REG_RX_FAST_LOCK_SETUP;
 
-	buf[0] = values[0];
-	buf[1] = RX_FAST_LOCK_PROFILE_ADDR(profile) | RX_FAST_LOCK_PROFILE_WORD(0);
-	ad9361_spi_writem(phy->spi, REG_RX_FAST_LOCK_PROGRAM_DATA + offs, buf, 2);
-
-	for (i = 1; i < RX_FAST_LOCK_CONFIG_WORD_NUM; i++) {
-		buf[0] = RX_FAST_LOCK_PROGRAM_WRITE | RX_FAST_LOCK_PROGRAM_CLOCK_ENABLE;
-		buf[1] = 0;
-		buf[2] = values[i];
-		buf[3] = RX_FAST_LOCK_PROFILE_ADDR(profile) | RX_FAST_LOCK_PROFILE_WORD(i);
-		ad9361_spi_writem(phy->spi, REG_RX_FAST_LOCK_PROGRAM_CTRL + offs, buf, 4);
-	}
-
-	ad9361_spi_write(phy->spi, REG_RX_FAST_LOCK_PROGRAM_CTRL + offs,
-			 RX_FAST_LOCK_PROGRAM_WRITE | RX_FAST_LOCK_PROGRAM_CLOCK_ENABLE);
-	ad9361_spi_write(phy->spi, REG_RX_FAST_LOCK_PROGRAM_CTRL + offs, 0);
+	/* Each strobe writes the word set up before it, send all in one message */
+	for (i = 0; i < RX_FAST_LOCK_CONFIG_WORD_NUM; i++) {
+		if (i)
+			ret |= ad9361_spi_queue_write(phy,
+						      REG_RX_FAST_LOCK_PROGRAM_CTRL + offs,
+						      RX_FAST_LOCK_PROGRAM_WRITE |
+						      RX_FAST_LOCK_PROGRAM_CLOCK_ENABLE);
+		ret |= ad9361_spi_queue_write(phy, REG_RX_FAST_LOCK_PROGRAM_DATA + offs,
+					      values[i]);
+		ret |= ad9361_spi_queue_write(phy, REG_RX_FAST_LOCK_PROGRAM_ADDR + offs,
+					      RX_FAST_LOCK_PROFILE_ADDR(profile) |
+					      RX_FAST_LOCK_PROFILE_WORD(i));
+	}
+
+	ret |= ad9361_spi_queue_write(phy, REG_RX_FAST_LOCK_PROGRAM_CTRL + offs,
+				      RX_FAST_LOCK_PROGRAM_WRITE |
+				      RX_FAST_LOCK_PROGRAM_CLOCK_ENABLE);
+	ret |= ad9361_spi_queue_write(phy, REG_RX_FAST_LOCK_PROGRAM_CTRL + offs, 0);
+	ret |= ad9361_spi_queue_flush(phy);
 
 	phy->fastlock.entry[tx][profile].flags = FASTLOOK_INIT;
 	phy->fastlock.entry[tx][profile].alc_orig = values[15];
@@ -4938,22 +5245,19 @@ int32_t ad9361_fastlock_load(struct ad9361_rf_phy *phy, bool tx,
 }
 
 /**
- * Fastlock store.
+ * Fastlock read setup.
+ * Build the fastlock profile words of the current synthesizer setup.
  * @param phy The AD9361 state structure.
  * @param tx
- * @param profile
+ * @param val The profile words (RX_FAST_LOCK_CONFIG_WORD_NUM).
  * @return 0 in case of success, negative error code otherwise.
  */
-int32_t ad9361_fastlock_store(struct ad9361_rf_phy *phy, bool tx,
-			      uint32_t profile)
+static int32_t ad9361_fastlock_read_setup(struct ad9361_rf_phy *phy, bool tx,
+		uint8_t *val)
 {
 	struct spi_device *spi = phy->spi;
-	uint8_t val[16];
 	uint32_t offs = 0, x, y;
 
-	dev_dbg(&phy->spi->dev, "%s: %s Profile %"PRIu32":",
-		__func__, tx ? "TX" : "RX", profile);
-
 	if (tx)
 		offs = REG_TX_FAST_LOCK_SETUP - REG_RX_FAST_LOCK_SETUP;
 
@@ -5005,6 +5309,26 @@ int32_t ad9361_fastlock_store(struct ad9361_rf_phy *phy, bool tx,
 	y = ad9361_spi_readf(spi, REG_RX_FORCE_VCO_TUNE_1 + offs, FORCE_VCO_TUNE);
 	val[15] = (x << 1) | y;
 
+	return 0;
+}
+
+/**
+ * Fastlock store.
+ * @param phy The AD9361 state structure.
+ * @param tx
+ * @param profile
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_fastlock_store(struct ad9361_rf_phy *phy, bool tx,
+			      uint32_t profile)
+{
+	uint8_t val[RX_FAST_LOCK_CONFIG_WORD_NUM];
+
+	dev_dbg(&phy->spi->dev, "%s: %s Profile %"PRIu32":",
+		__func__, tx ? "TX" : "RX", profile);
+
+	ad9361_fastlock_read_setup(phy, tx, val);
+
 	return ad9361_fastlock_load(phy, tx, profile, val);
 }
 
@@ -5144,6 +5468,142 @@ int32_t ad9361_fastlock_save(struct ad9361_rf_phy *phy, bool tx,
 	return 0;
 }
 
+/**
+ * Fastlock hop table init.
+ * Attach the entries to a hop table. The entries are plain data, they can be
+ * built once by ad9361_hop_table_build() and stored by the application (e.g.
+ * in a file) to skip the build on the next run.
+ * @param table The hop table.
+ * @param tx
+ * @param entry The entries, one per frequency.
+ * @param num_entries The number of entries.
+ * @return None.
+ */
+void ad9361_hop_table_init(struct ad9361_hop_table *table, bool tx,
+			   struct ad9361_hop_entry *entry, uint32_t num_entries)
+{
+	uint32_t i;
+
+	table->tx = tx;
+	table->entry = entry;
+	table->num_entries = num_entries;
+	table->next_slot = 0;
+	for (i = 0; i < AD9361_FASTLOCK_SLOTS; i++)
+		table->slot_entry[i] = -1;
+}
+
+/**
+ * Fastlock hop table build.
+ * Tune the synthesizer to every frequency (synthesizer setup and VCO
+ * calibration) and keep the resulting fastlock profile in the table. The
+ * original LO frequency is restored at the end.
+ * @param phy The AD9361 state structure.
+ * @param table The hop table, with room for num_entries entries.
+ * @param freq_hz The frequencies (Hz).
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_hop_table_build(struct ad9361_rf_phy *phy,
+			       struct ad9361_hop_table *table,
+			       const uint64_t *freq_hz)
+{
+	struct refclk_scale *clk_priv;
+	uint32_t i, orig_rate;
+	int32_t ret = 0;
+
+	clk_priv = phy->ref_clk_scale[table->tx ? TX_RFPLL : RX_RFPLL];
+	orig_rate = clk_get_rate(phy, clk_priv);
+
+	for (i = 0; i < table->num_entries; i++) {
+		ret = clk_set_rate(phy, clk_priv, ad9361_to_clk(freq_hz[i]));
+		if (ret < 0)
+			break;
+
+		table->entry[i].freq_hz = freq_hz[i];
+		ret = ad9361_fastlock_read_setup(phy, table->tx,
+						 table->entry[i].values);
+		if (ret < 0)
+			break;
+	}
+
+	/* The profiles loaded in the device are not affected */
+	if (clk_set_rate(phy, clk_priv, orig_rate) < 0)
+		dev_err(&phy->spi->dev, "%s: LO restore failed", __func__);
+
+	return ret;
+}
+
+/**
+ * Fastlock hop table load.
+ * Make sure the profile of an entry is in one of the device slots, loading it
+ * in place of the oldest one if needed. The slot of the active profile is
+ * never reused. The table owns the slots: ad9361_fastlock_store/load() must
+ * not be used on the same path (RX or TX) while the table is in use.
+ * @param phy The AD9361 state structure.
+ * @param table The hop table.
+ * @param index The entry.
+ * @return The slot (0 - 7) in case of success, negative error code otherwise.
+ */
+int32_t ad9361_hop_table_load(struct ad9361_rf_phy *phy,
+			      struct ad9361_hop_table *table, uint32_t index)
+{
+	uint8_t active;
+	uint32_t slot;
+	int32_t ret;
+
+	if (index >= table->num_entries)
+		return -EINVAL;
+
+	for (slot = 0; slot < AD9361_FASTLOCK_SLOTS; slot++)
+		if (table->slot_entry[slot] == (int32_t)index)
+			return slot;
+
+	/* current_profile is the active slot + 1, 0 if none */
+	active = phy->fastlock.current_profile[table->tx];
+	slot = table->next_slot;
+	if (active && (slot == (uint32_t)(active - 1)))
+		slot = (slot + 1) % AD9361_FASTLOCK_SLOTS;
+	table->next_slot = (slot + 1) % AD9361_FASTLOCK_SLOTS;
+
+	table->slot_entry[slot] = -1;
+	ret = ad9361_fastlock_load(phy, table->tx, slot,
+				   table->entry[index].values);
+	if (ret < 0)
+		return ret;
+	table->slot_entry[slot] = index;
+
+	return slot;
+}
+
+/**
+ * Fastlock hop.
+ * Switch the LO to the frequency of an entry. When the profile is already in
+ * a device slot only the recall is done, no synthesizer calculation or VCO
+ * calibration is involved. On RX, as for a regular LO change, the gain table
+ * of the band of the new frequency is loaded when it differs from the current
+ * one, so hops within a band cost no gain table write.
+ * @param phy The AD9361 state structure.
+ * @param table The hop table.
+ * @param index The entry.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_hop(struct ad9361_rf_phy *phy, struct ad9361_hop_table *table,
+		   uint32_t index)
+{
+	int32_t slot;
+	int32_t ret;
+
+	slot = ad9361_hop_table_load(phy, table, index);
+	if (slot < 0)
+		return slot;
+
+	ret = ad9361_fastlock_recall(phy, table->tx, slot);
+	if (ret < 0 || table->tx)
+		return ret;
+
+	return ad9361_load_gt(phy, table->entry[index].freq_hz,
+			      GT_RX1 + GT_RX2);
+}
+
 /**
  * Multi Chip Sync (MCS) config.
  * @param phy The AD9361 state structure.
@@ -5734,6 +6194,7 @@ int32_t ad9361_load_fir_filter_coef(struct ad9361_rf_phy *phy,
 {
 	struct spi_device *spi = phy->spi;
 	uint32_t val, offs = 0, fir_conf = 0, fir_enable = 0;
+	int32_t ret;
 
 	dev_dbg(&phy->spi->dev, "%s: TAPS %"PRIu32", gain %"PRId32", dest %d",
 		__func__, ntaps, gain_dB, dest);
@@ -5773,23 +6234,25 @@ int32_t ad9361_load_fir_filter_coef(struct ad9361_rf_phy *phy,
 
 	fir_conf |= FIR_NUM_TAPS(val) | FIR_SELECT(dest) | FIR_START_CLK;
 
-	ad9361_spi_write(spi, REG_TX_FILTER_CONF + offs, fir_conf);
+	ad9361_spi_queue_write(phy, REG_TX_FILTER_CONF + offs, fir_conf);
 
 	for (val = 0; val < ntaps; val++) {
-		ad9361_spi_write(spi, REG_TX_FILTER_COEF_ADDR + offs, val);
-		ad9361_spi_write(spi, REG_TX_FILTER_COEF_WRITE_DATA_1 + offs,
-				 coef[val] & 0xFF);
-		ad9361_spi_write(spi, REG_TX_FILTER_COEF_WRITE_DATA_2 + offs,
-				 coef[val] >> 8);
-		ad9361_spi_write(spi, REG_TX_FILTER_CONF + offs,
-				 fir_conf | FIR_WRITE);
-		ad9361_spi_write(spi, REG_TX_FILTER_COEF_READ_DATA_2 + offs, 0);
-		ad9361_spi_write(spi, REG_TX_FILTER_COEF_READ_DATA_2 + offs, 0);
-	}
-
-	ad9361_spi_write(spi, REG_TX_FILTER_CONF + offs, fir_conf);
+		ad9361_spi_queue_write(phy, REG_TX_FILTER_COEF_ADDR + offs, val);
+		ad9361_spi_queue_write(phy, REG_TX_FILTER_COEF_WRITE_DATA_1 + offs,
+				       coef[val] & 0xFF);
+		ad9361_spi_queue_write(phy, REG_TX_FILTER_COEF_WRITE_DATA_2 + offs,
+				       coef[val] >> 8);
+		ad9361_spi_queue_write(phy, REG_TX_FILTER_CONF + offs,
+				       fir_conf | FIR_WRITE);
+		ad9361_spi_queue_write(phy, REG_TX_FILTER_COEF_READ_DATA_2 + offs, 0);
+		ad9361_spi_queue_write(phy, REG_TX_FILTER_COEF_READ_DATA_2 + offs, 0);
+	}
+
+	ad9361_spi_queue_write(phy, REG_TX_FILTER_CONF + offs, fir_conf);
 	fir_conf &= ~FIR_START_CLK;
-	ad9361_spi_write(spi, REG_TX_FILTER_CONF + offs, fir_conf);
+	ad9361_spi_queue_write(phy, REG_TX_FILTER_CONF + offs, fir_conf);
+
+	ret = ad9361_spi_queue_flush(phy);
 
 	if (dest & FIR_IS_RX)
 		ad9361_spi_writef(phy->spi, REG_RX_ENABLE_FILTER_CTRL,
@@ -5800,6 +6263,9 @@ int32_t ad9361_load_fir_filter_coef(struct ad9361_rf_phy *phy,
 
 	ad9361_ensm_restore_prev_state(phy);
 
+	if (ret < 0)
+		return ret;
+
 	return ad9361_verify_fir_filter_coef(phy, dest, ntaps, coef);
 }
 
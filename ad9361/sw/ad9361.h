@@ -2836,6 +2836,8 @@
 #define MAX_DAC_CLK			(MAX_ADC_CLK / 2)
 
 #define MAX_MBYTE_SPI			8
+#define AD9361_SPI_QUEUE_SIZE		64
+#define AD9361_NUM_REGS			1024
 
 #define RFPLL_MODULUS			8388593UL
 #define BBPLL_MODULUS			2088960UL
@@ -3300,6 +3302,29 @@ struct ad9361_fastlock {
 	struct ad9361_fastlock_entry entry[2][8];
 };
 
+#define AD9361_FASTLOCK_SLOTS	8
+
+struct ad9361_hop_entry {
+	uint64_t	freq_hz;
+	uint8_t		values[RX_FAST_LOCK_CONFIG_WORD_NUM];
+};
+
+struct ad9361_hop_table {
+	bool			tx;
+	struct ad9361_hop_entry	*entry;
+	uint32_t		num_entries;
+	/* Entry loaded in each profile slot, -1 if none */
+	int32_t			slot_entry[AD9361_FASTLOCK_SLOTS];
+	uint8_t			next_slot;
+};
+
+struct ad9361_reg_cache {
+	struct spi_device	*spi;
+	uint8_t			val[AD9361_NUM_REGS];
+	uint8_t			valid[AD9361_NUM_REGS / 8];
+	struct ad9361_reg_cache	*next;
+};
+
 enum dig_tune_flags {
 	BE_VERBOSE = 1,
 	BE_MOREVERBOSE = 2,
@@ -3396,6 +3421,9 @@ struct ad9361_rf_phy {
 	uint32_t				bist_tone_level_dB;
 	uint32_t				bist_tone_mask;
 	bool			bbpll_initialized;
+	uint8_t			spi_queue[AD9361_SPI_QUEUE_SIZE * 3];
+	uint32_t		spi_queue_len;
+	struct ad9361_reg_cache	*reg_cache;
 };
 
 struct refclk_scale {
@@ -3426,6 +3454,11 @@ int32_t ad9361_spi_readm(struct spi_device *spi, uint32_t reg,
 int32_t ad9361_spi_read(struct spi_device *spi, uint32_t reg);
 int32_t ad9361_spi_write(struct spi_device *spi,
 			 uint32_t reg, uint32_t val);
+int32_t ad9361_spi_queue_write(struct ad9361_rf_phy *phy,
+			       uint32_t reg, uint32_t val);
+int32_t ad9361_spi_queue_flush(struct ad9361_rf_phy *phy);
+int32_t ad9361_spi_cache_enable(struct ad9361_rf_phy *phy);
+int32_t ad9361_spi_cache_disable(struct ad9361_rf_phy *phy);
 int32_t ad9361_reset(struct ad9361_rf_phy *phy);
 int32_t register_clocks(struct ad9361_rf_phy *phy);
 int32_t ad9361_init_gain_tables(struct ad9361_rf_phy *phy);
@@ -3516,6 +3549,15 @@ int32_t ad9361_fastlock_load(struct ad9361_rf_phy *phy, bool tx,
 			     uint32_t profile, uint8_t *values);
 int32_t ad9361_fastlock_save(struct ad9361_rf_phy *phy, bool tx,
 			     uint32_t profile, uint8_t *values);
+void ad9361_hop_table_init(struct ad9361_hop_table *table, bool tx,
+			   struct ad9361_hop_entry *entry, uint32_t num_entries);
+int32_t ad9361_hop_table_build(struct ad9361_rf_phy *phy,
+			       struct ad9361_hop_table *table,
+			       const uint64_t *freq_hz);
+int32_t ad9361_hop_table_load(struct ad9361_rf_phy *phy,
+			      struct ad9361_hop_table *table, uint32_t index);
+int32_t ad9361_hop(struct ad9361_rf_phy *phy, struct ad9361_hop_table *table,
+		   uint32_t index);
 void ad9361_ensm_force_state(struct ad9361_rf_phy *phy, uint8_t ensm_state);
 uint8_t ad9361_ensm_get_state(struct ad9361_rf_phy *phy);
 void ad9361_ensm_restore_state(struct ad9361_rf_phy *phy, uint8_t ensm_state);
@@ -441,6 +441,18 @@ int32_t ad9361_rx_fastlock_load(struct ad9361_rf_phy *phy, uint32_t profile,
 /* Save RX fastlock profile. */
 int32_t ad9361_rx_fastlock_save(struct ad9361_rf_phy *phy, uint32_t profile,
 				uint8_t *values);
+/* Build a RX hop table of fastlock profiles. */
+int32_t ad9361_rx_hop_table_build(struct ad9361_rf_phy *phy,
+				  struct ad9361_hop_table *table,
+				  struct ad9361_hop_entry *entry,
+				  const uint64_t *freq_hz, uint32_t num_entries);
+/* Init a RX hop table with previously built profiles. */
+void ad9361_rx_hop_table_init(struct ad9361_hop_table *table,
+			      struct ad9361_hop_entry *entry,
+			      uint32_t num_entries);
+/* Hop the RX LO to the frequency of a hop table entry. */
+int32_t ad9361_rx_hop(struct ad9361_rf_phy *phy,
+		      struct ad9361_hop_table *table, uint32_t index);
 /* Power down the RX Local Oscillator. */
 int32_t ad9361_rx_lo_powerdown(struct ad9361_rf_phy *phy, uint8_t option);
 /* Get the RX Local Oscillator power status. */
@@ -503,6 +515,18 @@ int32_t ad9361_tx_fastlock_load(struct ad9361_rf_phy *phy, uint32_t profile,
 /* Save TX fastlock profile. */
 int32_t ad9361_tx_fastlock_save(struct ad9361_rf_phy *phy, uint32_t profile,
 				uint8_t *values);
+/* Build a TX hop table of fastlock profiles. */
+int32_t ad9361_tx_hop_table_build(struct ad9361_rf_phy *phy,
+				  struct ad9361_hop_table *table,
+				  struct ad9361_hop_entry *entry,
+				  const uint64_t *freq_hz, uint32_t num_entries);
+/* Init a TX hop table with previously built profiles. */
+void ad9361_tx_hop_table_init(struct ad9361_hop_table *table,
+			      struct ad9361_hop_entry *entry,
+			      uint32_t num_entries);
+/* Hop the TX LO to the frequency of a hop table entry. */
+int32_t ad9361_tx_hop(struct ad9361_rf_phy *phy,
+		      struct ad9361_hop_table *table, uint32_t index);
 /* Power down the TX Local Oscillator. */
 int32_t ad9361_tx_lo_powerdown(struct ad9361_rf_phy *phy, uint8_t option);
 /* Get the TX Local Oscillator power status. */
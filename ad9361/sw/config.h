@@ -49,6 +49,7 @@
 
 #define HAVE_SPLIT_GAIN_TABLE	1 /* only set to 0 in case split_gain_table_mode_enable = 0*/
 #define HAVE_TDD_SYNTH_TABLE	1 /* only set to 0 in case split_gain_table_mode_enable = 0*/
+#define HAVE_SPI_REG_CACHE	1 /* set it 0 to always read the registers from the device (saves ~1.2kB) */
 
 #define AD9361_DEVICE			1 /* set it 1 if AD9361 device is used, 0 otherwise */
 #define AD9364_DEVICE			0 /* set it 1 if AD9364 device is used, 0 otherwise */
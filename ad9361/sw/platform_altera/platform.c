@@ -204,6 +204,25 @@ int spi_write_then_read(struct spi_device *spi,
 	return SUCCESS;
 }
 
+/***************************************************************************//**
+ * @brief spi_write_msgs
+*******************************************************************************/
+int spi_write_msgs(struct spi_device *spi,
+		const unsigned char *txbuf, unsigned n_tx,
+		unsigned n_msgs)
+{
+	int ret;
+
+	while (n_msgs--) {
+		ret = spi_write_then_read(spi, txbuf, n_tx, NULL, 0);
+		if (ret < 0)
+			return ret;
+		txbuf += n_tx;
+	}
+
+	return 0;
+}
+
 /***************************************************************************//**
  * @brief alt_avl_gpio_read
 *******************************************************************************/
@@ -81,6 +81,16 @@ int spi_write_then_read(struct spi_device *spi,
 	return 0;
 }
 
+/***************************************************************************//**
+ * @brief spi_write_msgs
+*******************************************************************************/
+int spi_write_msgs(struct spi_device *spi,
+		const unsigned char *txbuf, unsigned n_tx,
+		unsigned n_msgs)
+{
+	return 0;
+}
+
 /***************************************************************************//**
  * @brief gpio_init
 *******************************************************************************/
@@ -48,6 +48,7 @@
 #include "dac_core.h"
 
 #include <fcntl.h>
+#include <string.h>
 #include <errno.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
@@ -55,6 +56,11 @@
 #include <linux/types.h>
 #include <linux/spi/spidev.h>
 
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+#define SPI_MAX_MSGS	64
+
 /******************************************************************************/
 /************************ Variables Definitions *******************************/
 /******************************************************************************/
@@ -181,6 +187,51 @@ int spi_write_then_read(struct spi_device *spi,
 	return ret;
 }
 
+/***************************************************************************//**
+ * @brief spi_write_msgs
+ * Sends "n_msgs" frames of "n_tx" bytes each, the chip select is toggled
+ * between the frames. The frames are grouped in SPI_IOC_MESSAGE() requests
+ * of up to SPI_MAX_MSGS transfers.
+*******************************************************************************/
+int spi_write_msgs(struct spi_device *spi,
+		const unsigned char *txbuf, unsigned n_tx,
+		unsigned n_msgs)
+{
+	struct spi_ioc_transfer tr[SPI_MAX_MSGS];
+	unsigned i, n;
+	int fd = spidev_fd;
+	int ret;
+
+	if (spi->id_no != 0) {
+#ifdef FMCOMMS5
+		fd = spidev_b_fd;
+#else
+		return 0;
+#endif
+	}
+
+	while (n_msgs) {
+		n = min(n_msgs, SPI_MAX_MSGS);
+		memset(tr, 0, n * sizeof(tr[0]));
+		for (i = 0; i < n; i++) {
+			tr[i].tx_buf = (unsigned long)txbuf;
+			tr[i].len = n_tx;
+			tr[i].cs_change = (i != n - 1);
+			txbuf += n_tx;
+		}
+
+		ret = ioctl(fd, SPI_IOC_MESSAGE(n), tr);
+		if (ret < 0) {
+			printf("%s: Can't send spi message\n\r", __func__);
+			return -EIO;
+		}
+
+		n_msgs -= n;
+	}
+
+	return 0;
+}
+
 /***************************************************************************//**
  * @brief gpio_init
 *******************************************************************************/
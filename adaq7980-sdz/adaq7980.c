@@ -58,15 +58,34 @@ int32_t adaq7980_setup(adaq7980_dev **device,
 	adaq7980_dev *dev;
 	int32_t ret = 0;
 
-	dev = (adaq7980_dev *)malloc(sizeof(*dev));
+	dev = (adaq7980_dev *)calloc(1, sizeof(*dev));
 	if (!dev) {
 		return -1;
 	}
 
-	dev->spi_dev.chip_select = init_param.spi_chip_select;
-	dev->spi_dev.mode = init_param.spi_mode;
-	dev->spi_dev.device_id = init_param.spi_device_id;
-	dev->spi_dev.type = init_param.spi_type;
+	ret = spi_engine_init(&dev->spi_desc, &init_param.spi_init);
+	if (ret < 0) {
+		free(dev);
+		return ret;
+	}
+
+	/*
+	 * CS drives CNV: a high pulse starts the conversion, the result is
+	 * clocked out as one 16-bit word once CNV is low again.
+	 */
+	ret = spi_engine_set_transfer_width(dev->spi_desc, 16);
+	if (ret < 0)
+		goto error;
+	spi_engine_program_init(dev->spi_desc, &dev->conv_prog);
+	spi_engine_program_cs(dev->spi_desc, &dev->conv_prog, true);
+	spi_engine_program_cs(dev->spi_desc, &dev->conv_prog, false);
+	spi_engine_program_sleep(dev->spi_desc, &dev->conv_prog, 5000);
+	spi_engine_program_cs(dev->spi_desc, &dev->conv_prog, true);
+	spi_engine_program_transfer(&dev->conv_prog, NULL, true, 1);
+	spi_engine_program_cs(dev->spi_desc, &dev->conv_prog, false);
+	ret = spi_engine_program_end(&dev->conv_prog);
+	if (ret < 0)
+		goto error;
 
 	dev->gpio_dev.device_id = init_param.gpio_device_id;
 	dev->gpio_dev.type = init_param.gpio_type;
@@ -85,4 +104,45 @@ int32_t adaq7980_setup(adaq7980_dev **device,
 		printf("adaq7980 successfully initialized\n");
 
 	return ret;
+
+error:
+	adaq7980_remove(dev);
+	return ret;
+}
+
+/**
+ * Free the resources allocated by adaq7980_setup().
+ * @param dev - The device structure.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t adaq7980_remove(adaq7980_dev *dev)
+{
+	int32_t ret;
+
+	ret = spi_engine_remove(dev->spi_desc);
+
+	free(dev);
+
+	return ret;
+}
+
+/**
+ * Start a conversion and read its result.
+ * @param dev - The device structure.
+ * @param data - The conversion result.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t adaq7980_read_data(adaq7980_dev *dev,
+						   uint16_t *data)
+{
+	uint32_t word;
+	int32_t ret;
+
+	ret = spi_engine_program_run(dev->spi_desc, &dev->conv_prog, &word);
+	if (ret < 0)
+		return ret;
+
+	*data = word;
+
+	return 0;
 }
@@ -39,13 +39,20 @@
 #ifndef ADAQ7980_H_
 #define ADAQ7980_H_
 
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include "spi_engine.h"
+
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
 
 typedef struct {
 	/* SPI */
-	spi_device			spi_dev;
+	struct spi_engine_desc		*spi_desc;
+	/* Conversion and readout, also run by the offload */
+	struct spi_engine_program	conv_prog;
 	/* GPIO */
 	gpio_device			gpio_dev;
 	int8_t				gpio_pd_ldo;
@@ -55,10 +62,7 @@ typedef struct {
 
 typedef struct {
 	/* SPI */
-	uint8_t				spi_chip_select;
-	spi_mode			spi_mode;
-	spi_type			spi_type;
-	uint32_t			spi_device_id;
+	struct spi_engine_init_param	spi_init;
 	/* GPIO */
 	gpio_type			gpio_type;
 	uint32_t			gpio_device_id;
@@ -72,5 +76,9 @@ typedef struct {
 /******************************************************************************/
 int32_t adaq7980_setup(adaq7980_dev **device,
 					 adaq7980_init_param init_param);
+int32_t adaq7980_remove(adaq7980_dev *dev);
+/* Start a conversion and read its result. */
+int32_t adaq7980_read_data(adaq7980_dev *dev,
+						   uint16_t *data);
 
 #endif
@@ -47,8 +47,9 @@
 #include <xil_cache.h>
 #include <xparameters.h>
 #include "platform_drivers.h"
-#include "adaq7980.h"
 #include "spi_engine.h"
+#include "axi_dmac.h"
+#include "adaq7980.h"
 
 /******************************************************************************/
 /********************** Macros and Constants Definitions **********************/
@@ -71,16 +72,27 @@
 #define GPIO_RBUF_PUB					GPIO_OFFSET + 9
 #define ADC_DDR_BASEADDR				XPAR_DDR_MEM_BASEADDR + 0x800000
 
+#define SPI_ENGINE_OFFLOAD_EXAMPLE		0
+
+#define ADAQ7980_OFFLOAD_SLOT			0
+#define ADAQ7980_OFFLOAD_BUFFERS		4
+/* Conversions per buffer, one 32-bit word each */
+#define ADAQ7980_OFFLOAD_SAMPLES		256
+
 /******************************************************************************/
 /************************ Variables Definitions *******************************/
 /******************************************************************************/
 
 adaq7980_init_param default_init_param = {
-	/* SPI */
-	SPI_ADAQ7980_CS,	// spi_chip_select
-	SPI_MODE_2,			// spi_mode
-	SPI_ENGINE,			// spi_type
-	-1,					// spi_device_id
+	/* SPI engine */
+	{
+		ADAQ7980_SPI_ENGINE_BASEADDR,	// base
+		SPI_ADAQ7980_CS,				// chip_select
+		1,								// cs_delay
+		SPI_ENGINE_CONFIG_CPHA,			// config
+		100000000,						// ref_clk_hz
+		1000000,						// spi_clk_hz
+	},
 	/* GPIO */
 	PS7_GPIO,			// gpio_type
 	GPIO_DEVICE_ID,		// gpio_device_id
@@ -89,68 +101,88 @@ adaq7980_init_param default_init_param = {
 	GPIO_RBUF_PUB,		// gpio_rbuf_pd
 };
 
-uint32_t spi_msg_cmds[6] = {CS_DEASSERT, CS_ASSERT, SLEEP(5000), CS_DEASSERT, TRANSFER_R(4), CS_ASSERT};
-
-spi_init_param spi_default_init_param = {
-		ADAQ7980_SPI_ENGINE_BASEADDR,	// adc_baseaddr
-		0,								// chip_select
-		SPI_ENGINE_CONFIG_CPHA,			// spi_config
-		1000000,						// spi_clk_hz
-		100000000,						// ref_clk_hz
-		1,								// spi_offload_rx_support_en
-		ADAQ7980_DMA_BASEADDR,			// spi_offload_rx_dma_baseaddr
-		0,								// spi_offload_tx_support_en
-		ADAQ7980_DMA_BASEADDR,			// spi_offload_tx_dma_baseaddr
+struct axi_dmac_init adaq7980_dmac_init = {
+	"adaq7980_dmac",
+	ADAQ7980_DMA_BASEADDR,
+	DMA_DEV_TO_MEM,
+	0,
+	false
 };
 
-#define SPI_ENGINE_OFFLOAD_EXAMPLE	0
-
 /***************************************************************************//**
  * @brief main
  *******************************************************************************/
 int main(void)
 {
 	adaq7980_dev	*dev;
-	spi_dev			*spi_dev;
-	spi_msg 		*msg;
-	uint8_t			*data;
-	uint32_t		i;
+	struct axi_dmac	*dmac;
+	struct spi_engine_stream_init stream_init;
+	struct spi_engine_stream *stream;
+	struct axi_dmac_stream_buf *bufs[ADAQ7980_OFFLOAD_BUFFERS];
+	uint32_t		*offload_data;
+	uint16_t		adc_data;
+	uint32_t		i, n;
+	int32_t			ret;
 
 	Xil_ICacheEnable();
 	Xil_DCacheEnable();
 
-	adaq7980_setup(&dev, default_init_param);
-	spi_eng_setup(&spi_dev, spi_default_init_param);
-
-	msg = (spi_msg *)malloc(sizeof(*msg));
-	if (!msg)
-		return -1;
-
-	msg->rx_buf_addr = 0x10000000;
-	msg->spi_msg_cmds = spi_msg_cmds;
-	msg->msg_cmd_len = sizeof(spi_msg_cmds) / sizeof(uint32_t);
+	ret = adaq7980_setup(&dev, default_init_param);
+	if (ret < 0)
+		return ret;
 
 	if (SPI_ENGINE_OFFLOAD_EXAMPLE == 0) {
 
 		while(1){
-			spi_eng_transfer_message(spi_dev, msg);
+			adaq7980_read_data(dev, &adc_data);
+			printf("ADC: %x\r\n", adc_data);
 			mdelay(1000);
 		}
 
 	} else {
-		spi_eng_offload_load_msg(spi_dev, msg);
-		spi_eng_transfer_multiple_msgs(spi_dev, 8);
-
-        data = (uint8_t*)spi_dev->rx_dma_startaddr;
+		ret = axi_dmac_init(&dmac, &adaq7980_dmac_init);
+		if (ret < 0)
+			return ret;
+
+		stream_init.slot = ADAQ7980_OFFLOAD_SLOT;
+		stream_init.prog = &dev->conv_prog;
+		stream_init.dmac = dmac;
+		stream_init.ring.address = ADC_DDR_BASEADDR;
+		stream_init.ring.size = ADAQ7980_OFFLOAD_SAMPLES * 4;
+		stream_init.ring.num_buffers = ADAQ7980_OFFLOAD_BUFFERS;
+		stream_init.ring.filled = NULL;
+		stream_init.ring.ctx = NULL;
+		ret = spi_engine_stream_init(&stream, dev->spi_desc,
+									 &stream_init);
+		if (ret < 0)
+			return ret;
+
+		/* Hold every buffer of the ring: one gap-free capture. */
+		ret = spi_engine_stream_start(stream);
+		for (n = 0; (ret == 0) && (n < ADAQ7980_OFFLOAD_BUFFERS); n++)
+			ret = spi_engine_stream_get(stream, &bufs[n], 2000);
+		spi_engine_stream_stop(stream);
+		if (ret < 0)
+			return ret;
+
+		for (n = 0; n < ADAQ7980_OFFLOAD_BUFFERS; n++) {
+			Xil_DCacheInvalidateRange(bufs[n]->address, bufs[n]->size);
+			if (bufs[n]->gap || (bufs[n]->seq != bufs[0]->seq + n))
+				printf("Samples lost\n");
+			offload_data = (uint32_t *)bufs[n]->address;
+			for (i = 0; i < ADAQ7980_OFFLOAD_SAMPLES; i++)
+				printf("%x\r\n", offload_data[i] & 0xFFFF);
+			spi_engine_stream_release(stream, bufs[n]);
+		}
 
-        for(i = 0; i < spi_dev->rx_length; i++) {
-    		printf("%x\r\n", *data);
-    		data += sizeof(uint8_t);
-        }
+		spi_engine_stream_remove(stream);
+		axi_dmac_remove(dmac);
 	}
 
 	printf("Bye\n");
 
+	adaq7980_remove(dev);
+
 	Xil_DCacheDisable();
 	Xil_ICacheDisable();
 
@@ -41,13 +41,7 @@
 /***************************** Include Files **********************************/
 /******************************************************************************/
 #include <xparameters.h>
-#ifdef _XPARAMETERS_PS_H_
-#include <sleep.h>
-#else
-#include <microblaze_sleep.h>
-#endif
 #include "platform_drivers.h"
-#include "spi_engine.h"
 
 /******************************************************************************/
 /************************ Variables Definitions *******************************/
@@ -64,8 +58,6 @@ int32_t spi_init(spi_device *dev)
 	uint8_t	 clk_pha;
 	uint8_t	 clk_pol;
 	uint32_t spi_options = 0;
-	spi_dev			*spi_dev;
-	spi_init_param spi_default_init_param = {};
 
 	clk_pha = (dev->mode & SPI_CPHA) >> 0;
 	clk_pol = (dev->mode & SPI_CPOL) >> 1;
@@ -115,9 +107,6 @@ int32_t spi_init(spi_device *dev)
 							   XSPIPS_CLK_PRESCALE_32);
 #endif
 		break;
-	case SPI_ENGINE:
-		spi_eng_setup(&spi_dev, spi_default_init_param);
-		break;
 	default:
 		return -1;
 	}
@@ -157,8 +146,6 @@ int32_t spi_write_and_read(spi_device *dev,
 		XSpiPs_PolledTransfer(&dev->ps7_instance, data, data, bytes_number);
 #endif
 		break;
-	case SPI_ENGINE:
-		break;
 	default:
 		return -1;
 	}
@@ -389,28 +376,3 @@ int32_t gpio_get_value(gpio_device *dev,
 	return 0;
 #endif
 }
-
-/***************************************************************************//**
-* @brief mdelay
-*******************************************************************************/
-void mdelay(uint32_t msecs)
-{
-#ifdef _XPARAMETERS_PS_H_
-	usleep(msecs * 1000);
-#else
-	MB_Sleep(msecs);
-#endif
-}
-
-/***************************************************************************//**
-* @brief do_div
-*******************************************************************************/
-uint64_t do_div(uint64_t* n, uint64_t base)
-{
-	uint64_t mod = 0;
-
-	mod = *n % base;
-	*n = *n / base;
-
-	return mod;
-}
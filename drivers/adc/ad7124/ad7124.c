@@ -44,6 +44,7 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include "ad7124.h"
+#include "crc8.h"
 
 /* Error codes */
 #define INVALID_VAL -1 /* Invalid argument */
@@ -57,6 +58,39 @@
  */
 #define AD7124_POST_RESET_DELAY      4
 
+/***************************************************************************//**
+ * @brief Writes and reads data to/from the device.
+ *
+ * The chip select GPIO, when used, is asserted for the transfer only. In
+ * continuous read mode it is already held asserted and the data ready
+ * interrupt is masked instead, as DOUT/RDY toggles with the data read out.
+ *
+ * @param dev          - The handler of the instance of the driver.
+ * @param data         - Data to be written, replaced by the data read.
+ * @param bytes_number - Number of bytes to transfer.
+ *
+ * @return Returns 0 for success or negative error code.
+*******************************************************************************/
+static int32_t ad7124_spi_write_and_read(struct ad7124_dev *dev,
+		uint8_t *data,
+		uint8_t bytes_number)
+{
+	int32_t ret;
+
+	if (dev->cont_read)
+		irq_source_disable(dev->irq_desc, dev->irq_id);
+	else if (dev->gpio_cs)
+		gpio_set_value(dev->gpio_cs, GPIO_LOW);
+
+	ret = spi_write_and_read(dev->spi_desc, data, bytes_number);
+
+	if (dev->cont_read)
+		irq_source_enable(dev->irq_desc, dev->irq_id);
+	else if (dev->gpio_cs)
+		gpio_set_value(dev->gpio_cs, GPIO_HIGH);
+
+	return ret;
+}
 
 /***************************************************************************//**
  * @brief Reads the value of the specified register without checking if the
@@ -95,10 +129,10 @@ int32_t ad7124_no_check_read_register(struct ad7124_dev *dev,
 	}
 
 	/* Read data from the device */
-	ret = spi_write_and_read(dev->spi_desc,
-				 buffer,
-				 ((dev->use_crc != AD7124_DISABLE_CRC) ? p_reg->size + 1
-				  : p_reg->size) + 1 + add_status_length);
+	ret = ad7124_spi_write_and_read(dev,
+					buffer,
+					((dev->use_crc != AD7124_DISABLE_CRC) ? p_reg->size + 1
+					 : p_reg->size) + 1 + add_status_length);
 	if(ret < 0)
 		return ret;
 
@@ -174,10 +208,10 @@ int32_t ad7124_no_check_write_register(struct ad7124_dev *dev,
 	}
 
 	/* Write data to the device */
-	ret = spi_write_and_read(dev->spi_desc,
-				 wr_buf,
-				 (dev->use_crc != AD7124_DISABLE_CRC) ? reg.size + 2
-				 : reg.size + 1);
+	ret = ad7124_spi_write_and_read(dev,
+					wr_buf,
+					(dev->use_crc != AD7124_DISABLE_CRC) ? reg.size + 2
+					: reg.size + 1);
 
 	return ret;
 }
@@ -253,9 +287,9 @@ int32_t ad7124_reset(struct ad7124_dev *dev)
 	if(!dev)
 		return INVALID_VAL;
 
-	ret = spi_write_and_read(dev->spi_desc,
-				 wr_buf,
-				 8);
+	ret = ad7124_spi_write_and_read(dev,
+					wr_buf,
+					8);
 
 	/* CRC is disabled after reset */
 	dev->use_crc = AD7124_DISABLE_CRC;
@@ -402,6 +436,196 @@ int32_t ad7124_read_data(struct ad7124_dev *dev,
 	return ret;
 }
 
+/***************************************************************************//**
+ * @brief Data ready interrupt handler, reads the conversion result and stores
+ *        it in the continuous read ring.
+ *
+ * The status byte is appended to the data in continuous read mode and a read
+ * whose RDY bit is set is dropped, as it was triggered by a stale edge and
+ * returns the previous result again.
+ *
+ * @param data - The handler of the instance of the driver.
+ *
+ * @return None.
+*******************************************************************************/
+static void ad7124_irq_handler(void *data)
+{
+	struct ad7124_dev *dev = data;
+	struct ad7124_st_reg *regs = dev->regs;
+	struct ad7124_sample *sample;
+	uint32_t wr = dev->ring_wr;
+
+	if (dev->irq_ack && !dev->irq_ack(dev->irq_ack_ctx))
+		return;
+
+	if (ad7124_no_check_read_register(dev, &regs[AD7124_Data]) < 0)
+		return;
+
+	if (regs[AD7124_Status].value & AD7124_STATUS_REG_RDY) {
+		dev->ring_stale++;
+		return;
+	}
+
+	if (wr - dev->ring_rd < AD7124_RING_SIZE) {
+		sample = &dev->ring[wr % AD7124_RING_SIZE];
+		sample->value = regs[AD7124_Data].value;
+		sample->channel = AD7124_STATUS_REG_CH_ACTIVE(
+					  regs[AD7124_Status].value);
+		dev->ring_wr = wr + 1;
+	} else {
+		dev->ring_overruns++;
+	}
+}
+
+/***************************************************************************//**
+ * @brief Clears DATA_STATUS if it was set by ad7124_cont_read_start().
+ *
+ * @param dev - The handler of the instance of the driver.
+ *
+ * @return Returns 0 for success or negative error code.
+*******************************************************************************/
+static int32_t ad7124_cont_read_restore_status(struct ad7124_dev *dev)
+{
+	struct ad7124_st_reg *regs = dev->regs;
+
+	if (!dev->cont_read_status)
+		return 0;
+
+	dev->cont_read_status = false;
+	regs[AD7124_ADC_Control].value &= ~AD7124_ADC_CTRL_REG_DATA_STATUS;
+
+	return ad7124_write_register(dev, regs[AD7124_ADC_Control]);
+}
+
+/***************************************************************************//**
+ * @brief Starts the interrupt driven continuous read mode.
+ *
+ * The ADC is put in continuous conversion mode and every result is read by the
+ * data ready interrupt, so no STATUS polling is done. DOUT/RDY must be wired to
+ * the irq_id GPIO interrupt (falling edge), irq_ack must be set when that
+ * interrupt is shared with other pins. The chip select GPIO is held
+ * asserted until the mode is stopped, as DOUT/RDY is high impedance otherwise,
+ * so the mode is not available when the SPI controller drives the chip select.
+ * Register accesses done meanwhile mask the data ready interrupt and a result
+ * completed during such an access is lost. DATA_STATUS is set while the mode
+ * runs so the interrupt handler can tell new results from stale edges.
+ *
+ * @param dev - The handler of the instance of the driver.
+ *
+ * @return Returns 0 for success or negative error code.
+*******************************************************************************/
+int32_t ad7124_cont_read_start(struct ad7124_dev *dev)
+{
+	struct ad7124_st_reg *regs;
+	int32_t ret;
+
+	if(!dev || !dev->irq_desc || !dev->gpio_cs || dev->cont_read)
+		return INVALID_VAL;
+
+	regs = dev->regs;
+
+	dev->ring_wr = 0;
+	dev->ring_rd = 0;
+	dev->ring_overruns = 0;
+	dev->ring_stale = 0;
+
+	/* Continuous conversion mode, with the status byte appended */
+	dev->cont_read_status = !(regs[AD7124_ADC_Control].value &
+				  AD7124_ADC_CTRL_REG_DATA_STATUS);
+	regs[AD7124_ADC_Control].value &= ~AD7124_ADC_CTRL_REG_MODE(0xF);
+	regs[AD7124_ADC_Control].value |= AD7124_ADC_CTRL_REG_DATA_STATUS;
+	ret = ad7124_write_register(dev, regs[AD7124_ADC_Control]);
+	if(ret < 0)
+		goto error_status;
+
+	ret = irq_register(dev->irq_desc, dev->irq_id, ad7124_irq_handler, dev);
+	if(ret < 0)
+		goto error_status;
+
+	ret = gpio_set_value(dev->gpio_cs, GPIO_LOW);
+	if(ret < 0)
+		goto error_unregister;
+
+	dev->cont_read = true;
+	ret = irq_source_enable(dev->irq_desc, dev->irq_id);
+	if(ret < 0)
+		goto error_cs;
+
+	return 0;
+
+error_cs:
+	dev->cont_read = false;
+	gpio_set_value(dev->gpio_cs, GPIO_HIGH);
+error_unregister:
+	irq_unregister(dev->irq_desc, dev->irq_id);
+error_status:
+	ad7124_cont_read_restore_status(dev);
+
+	return ret;
+}
+
+/***************************************************************************//**
+ * @brief Stops the interrupt driven continuous read mode and releases the chip
+ *        select. The ADC keeps its operating mode, the samples left in the
+ *        ring can still be read.
+ *
+ * @param dev - The handler of the instance of the driver.
+ *
+ * @return Returns 0 for success or negative error code.
+*******************************************************************************/
+int32_t ad7124_cont_read_stop(struct ad7124_dev *dev)
+{
+	int32_t ret;
+
+	if(!dev || !dev->cont_read)
+		return INVALID_VAL;
+
+	ret = irq_source_disable(dev->irq_desc, dev->irq_id);
+	if(ret < 0)
+		return ret;
+
+	dev->cont_read = false;
+	ret = irq_unregister(dev->irq_desc, dev->irq_id);
+	if(ret < 0)
+		return ret;
+
+	ret = gpio_set_value(dev->gpio_cs, GPIO_HIGH);
+	if(ret < 0)
+		return ret;
+
+	return ad7124_cont_read_restore_status(dev);
+}
+
+/***************************************************************************//**
+ * @brief Gets the samples captured in continuous read mode.
+ *
+ * @param dev         - The handler of the instance of the driver.
+ * @param samples     - Buffer to store the samples, oldest first.
+ * @param max_samples - Size of the buffer in samples.
+ *
+ * @return Returns the number of samples stored or negative error code.
+*******************************************************************************/
+int32_t ad7124_cont_read_samples(struct ad7124_dev *dev,
+				 struct ad7124_sample *samples,
+				 uint32_t max_samples)
+{
+	uint32_t rd, wr;
+	int32_t n = 0;
+
+	if(!dev || !samples)
+		return INVALID_VAL;
+
+	rd = dev->ring_rd;
+	wr = dev->ring_wr;
+	while((rd != wr) && (n < (int32_t)max_samples)) {
+		samples[n++] = dev->ring[rd % AD7124_RING_SIZE];
+		rd++;
+	}
+	dev->ring_rd = rd;
+
+	return n;
+}
+
 /***************************************************************************//**
  * @brief Computes the CRC checksum for a data buffer.
  *
@@ -412,24 +636,7 @@ int32_t ad7124_read_data(struct ad7124_dev *dev,
 *******************************************************************************/
 uint8_t ad7124_compute_crc8(uint8_t * p_buf, uint8_t buf_size)
 {
-	uint8_t i = 0;
-	uint8_t crc = 0;
-
-	while(buf_size) {
-		for(i = 0x80; i != 0; i >>= 1) {
-			bool cmp1 = (crc & 0x80) != 0;
-			bool cmp2 = (*p_buf & i) != 0;
-			if(cmp1 != cmp2) { /* MSB of CRC register XOR input Bit from Data */
-				crc <<= 1;
-				crc ^= AD7124_CRC8_POLYNOMIAL_REPRESENTATION;
-			} else {
-				crc <<= 1;
-			}
-		}
-		p_buf++;
-		buf_size--;
-	}
-	return crc;
+	return crc8(crc8_atm_table, p_buf, buf_size, 0);
 }
 
 /***************************************************************************//**
@@ -501,12 +708,34 @@ int32_t ad7124_setup(struct ad7124_dev **device,
 
 	dev->regs = init_param.regs;
 	dev->spi_rdy_poll_cnt = init_param.spi_rdy_poll_cnt;
+	dev->irq_desc = init_param.irq_desc;
+	dev->irq_id = init_param.irq_id;
+	dev->irq_ack = init_param.irq_ack;
+	dev->irq_ack_ctx = init_param.irq_ack_ctx;
+	dev->cont_read = false;
+	dev->cont_read_status = false;
+	dev->ring_wr = 0;
+	dev->ring_rd = 0;
+	dev->ring_overruns = 0;
+	dev->ring_stale = 0;
 
 	/* Initialize the SPI communication. */
 	ret = spi_init(&dev->spi_desc, &init_param.spi_init);
 	if (ret < 0)
 		return ret;
 
+	/* Initialize the chip select GPIO, deasserted. */
+	dev->gpio_cs = NULL;
+	if (init_param.gpio_cs) {
+		ret = gpio_get(&dev->gpio_cs, init_param.gpio_cs);
+		if (ret < 0)
+			return ret;
+
+		ret = gpio_direction_output(dev->gpio_cs, GPIO_HIGH);
+		if (ret < 0)
+			return ret;
+	}
+
 	/*  Reset the device interface.*/
 	ret = ad7124_reset(dev);
 	if (ret < 0)
@@ -549,6 +778,9 @@ int32_t ad7124_remove(struct ad7124_dev *dev)
 
 	ret = spi_remove(dev->spi_desc);
 
+	if (dev->gpio_cs)
+		ret |= gpio_remove(dev->gpio_cs);
+
 	free(dev);
 
 	return ret;
@@ -45,8 +45,11 @@
 /***************************** Include Files **********************************/
 /******************************************************************************/
 #include <stdint.h>
+#include <stdbool.h>
 #include "spi.h"
 #include "delay.h"
+#include "gpio.h"
+#include "irq.h"
 
 /******************************************************************************/
 /******************* Register map and register definitions ********************/
@@ -331,6 +334,17 @@ enum ad7124_registers {
 	AD7124_REG_NO
 };
 
+/* Number of samples held by the continuous read ring, a power of 2 */
+#define AD7124_RING_SIZE	128
+
+/*! Conversion result captured in continuous read mode */
+struct ad7124_sample {
+	/* Conversion result */
+	int32_t value;
+	/* Channel of the result, from the status byte */
+	uint8_t channel;
+};
+
 /*
  * The structure describes the device and is used with the ad7124 driver.
  * @spi_desc: A reference to the SPI configuration of the device.
@@ -342,6 +356,27 @@ enum ad7124_registers {
  * @spi_rdy_poll_cnt: Number of times the driver should read the Error register
  *                    to check if the device is ready to accept user requests,
  *                    before a timeout error will be issued.
+ * @gpio_cs: GPIO driving the chip select, NULL when it is driven by the SPI
+ *           controller. Required by the continuous read mode, which keeps the
+ *           chip select asserted so DOUT/RDY stays driven.
+ * @irq_desc: Interrupt controller of the data ready line, NULL when the
+ *            continuous read mode is not used.
+ * @irq_id: Interrupt of the GPIO wired to DOUT/RDY, set up by the platform for
+ *          the falling edge.
+ * @irq_ack: Called first by the data ready interrupt handler when irq_id is
+ *           shared by several pins, e.g. the PS GPIO bank interrupt. It must
+ *           clear the interrupt status of the DOUT/RDY pin and return whether
+ *           that pin raised the interrupt. NULL when irq_id is dedicated.
+ * @irq_ack_ctx: Argument passed to irq_ack.
+ * @cont_read: Whether the continuous read mode is running.
+ * @cont_read_status: Whether DATA_STATUS was set by the continuous read mode
+ *                    and has to be cleared when it stops.
+ * @ring: Samples read by the data ready interrupt in continuous read mode.
+ * @ring_wr: Number of samples written to the ring.
+ * @ring_rd: Number of samples read from the ring.
+ * @ring_overruns: Number of samples dropped because the ring was full.
+ * @ring_stale: Number of data ready interrupts ignored because the status byte
+ *              reported no new result.
  */
 struct ad7124_dev {
 	/* SPI */
@@ -351,6 +386,21 @@ struct ad7124_dev {
 	int16_t use_crc;
 	int16_t check_ready;
 	int16_t spi_rdy_poll_cnt;
+	/* GPIO */
+	struct gpio_desc	*gpio_cs;
+	/* Data ready interrupt */
+	struct irq_desc		*irq_desc;
+	uint32_t		irq_id;
+	bool			(*irq_ack)(void *ctx);
+	void			*irq_ack_ctx;
+	/* Continuous read */
+	volatile bool		cont_read;
+	bool			cont_read_status;
+	struct ad7124_sample	ring[AD7124_RING_SIZE];
+	volatile uint32_t	ring_wr;
+	volatile uint32_t	ring_rd;
+	volatile uint32_t	ring_overruns;
+	volatile uint32_t	ring_stale;
 };
 
 struct ad7124_init_param {
@@ -359,6 +409,14 @@ struct ad7124_init_param {
 	/* Device Settings */
 	struct ad7124_st_reg	*regs;
 	int16_t spi_rdy_poll_cnt;
+	/* GPIO, NULL when the chip select is driven by the SPI controller */
+	struct gpio_init_param	*gpio_cs;
+	/* Data ready interrupt */
+	struct irq_desc		*irq_desc;
+	uint32_t		irq_id;
+	/* DOUT/RDY pin acknowledge, NULL when irq_id is dedicated to the pin */
+	bool			(*irq_ack)(void *ctx);
+	void			*irq_ack_ctx;
 };
 
 /******************************************************************************/
@@ -407,6 +465,17 @@ int32_t ad7124_wait_for_conv_ready(struct ad7124_dev *dev,
 int32_t ad7124_read_data(struct ad7124_dev *dev,
 			 int32_t* p_data);
 
+/*! Starts the interrupt driven continuous read mode. */
+int32_t ad7124_cont_read_start(struct ad7124_dev *dev);
+
+/*! Stops the interrupt driven continuous read mode. */
+int32_t ad7124_cont_read_stop(struct ad7124_dev *dev);
+
+/*! Gets the samples captured in continuous read mode. */
+int32_t ad7124_cont_read_samples(struct ad7124_dev *dev,
+				 struct ad7124_sample *samples,
+				 uint32_t max_samples);
+
 /*! Computes the CRC checksum for a data buffer. */
 uint8_t ad7124_compute_crc8(uint8_t* p_buf,
 			    uint8_t buf_size);
@@ -46,12 +46,47 @@
 /******************************************************************************/
 #include <stdlib.h>
 #include "ad717x.h"
+#include "crc8.h"
 
 /* Error codes */
 #define INVALID_VAL -1 /* Invalid argument */
 #define COMM_ERR    -2 /* Communication error on receive */
 #define TIMEOUT     -3 /* A timeout has occured */
 
+/***************************************************************************//**
+* @brief Writes and reads data to/from the device.
+*
+* The chip select GPIO, when used, is asserted for the transfer only. In
+* continuous read mode it is already held asserted and the data ready interrupt
+* is masked instead, as DOUT/RDY toggles with the data read out.
+*
+* @param device      - The handler of the instance of the driver.
+* @param data        - Data to be written, replaced by the data read.
+* @param bytesNumber - Number of bytes to transfer.
+*
+* @return Returns 0 for success or negative error code.
+*******************************************************************************/
+static int32_t AD717X_SpiWriteAndRead(ad717x_dev *device,
+				      uint8_t *data,
+				      uint8_t bytesNumber)
+{
+	int32_t ret;
+
+	if (device->cont_read)
+		irq_source_disable(device->irq_desc, device->irq_id);
+	else if (device->gpio_cs)
+		gpio_set_value(device->gpio_cs, GPIO_LOW);
+
+	ret = spi_write_and_read(device->spi_desc, data, bytesNumber);
+
+	if (device->cont_read)
+		irq_source_enable(device->irq_desc, device->irq_id);
+	else if (device->gpio_cs)
+		gpio_set_value(device->gpio_cs, GPIO_HIGH);
+
+	return ret;
+}
+
 /***************************************************************************//**
 * @brief  Searches through the list of registers of the driver instance and
 *         retrieves a pointer to the register that matches the given address.
@@ -111,10 +146,10 @@ int32_t AD717X_ReadRegister(ad717x_dev *device,
 		    AD717X_COMM_REG_RA(pReg->addr);
 
 	/* Read data from the device */
-	ret = spi_write_and_read(device->spi_desc,
-				 buffer,
-				 ((device->useCRC != AD717X_DISABLE) ? pReg->size + 1
-				  : pReg->size) + 1);
+	ret = AD717X_SpiWriteAndRead(device,
+				     buffer,
+				     ((device->useCRC != AD717X_DISABLE) ? pReg->size + 1
+				      : pReg->size) + 1);
 	if(ret < 0)
 		return ret;
 
@@ -196,10 +231,10 @@ int32_t AD717X_WriteRegister(ad717x_dev *device,
 	}
 
 	/* Write data to the device */
-	ret = spi_write_and_read(device->spi_desc,
-				 wrBuf,
-				 (device->useCRC != AD717X_DISABLE) ?
-				 preg->size + 2 : preg->size + 1);
+	ret = AD717X_SpiWriteAndRead(device,
+				     wrBuf,
+				     (device->useCRC != AD717X_DISABLE) ?
+				     preg->size + 2 : preg->size + 1);
 
 	return ret;
 }
@@ -219,9 +254,9 @@ int32_t AD717X_Reset(ad717x_dev *device)
 	if(!device)
 		return INVALID_VAL;
 
-	ret = spi_write_and_read(device->spi_desc,
-				 wrBuf,
-				 8);
+	ret = AD717X_SpiWriteAndRead(device,
+				     wrBuf,
+				     8);
 
 	return ret;
 }
@@ -295,6 +330,208 @@ int32_t AD717X_ReadData(ad717x_dev *device,
 	return ret;
 }
 
+/***************************************************************************//**
+* @brief Data ready interrupt handler, reads the conversion result and stores it
+*        in the continuous read ring.
+*
+* The status byte is appended to the data in continuous read mode and a read
+* whose RDY bit is set is dropped, as it was triggered by a stale edge and
+* returns the previous result again.
+*
+* @param data - The handler of the instance of the driver.
+*
+* @return None.
+*******************************************************************************/
+static void AD717X_IrqHandler(void *data)
+{
+	ad717x_dev *device = data;
+	ad717x_sample *sample;
+	uint32_t wr = device->ring_wr;
+	int32_t value;
+
+	if (device->irq_ack && !device->irq_ack(device->irq_ack_ctx))
+		return;
+
+	if (AD717X_ReadData(device, &value) < 0)
+		return;
+
+	if (value & AD717X_STATUS_REG_RDY) {
+		device->ring_stale++;
+		return;
+	}
+
+	if (wr - device->ring_rd < AD717X_RING_SIZE) {
+		sample = &device->ring[wr % AD717X_RING_SIZE];
+		sample->channel = AD717X_STATUS_REG_CH(value);
+		sample->value = (uint32_t)value >> 8;
+		device->ring_wr = wr + 1;
+	} else {
+		device->ring_overruns++;
+	}
+}
+
+/***************************************************************************//**
+* @brief Clears DATA_STAT if it was set by AD717X_ContReadStart().
+*
+* @param device - The handler of the instance of the driver.
+*
+* @return Returns 0 for success or negative error code.
+*******************************************************************************/
+static int32_t AD717X_ContReadRestoreStatus(ad717x_dev *device)
+{
+	ad717x_st_reg *ifmodeReg;
+
+	if (!device->cont_read_status)
+		return 0;
+
+	device->cont_read_status = false;
+	ifmodeReg = AD717X_GetReg(device, AD717X_IFMODE_REG);
+	ifmodeReg->value &= ~AD717X_IFMODE_REG_DATA_STAT;
+
+	return AD717X_WriteRegister(device, AD717X_IFMODE_REG);
+}
+
+/***************************************************************************//**
+* @brief Starts the interrupt driven continuous read mode.
+*
+* The ADC is put in continuous conversion mode and every result is read by the
+* data ready interrupt, so no STATUS polling is done. DOUT/RDY must be wired to
+* the irq_id GPIO interrupt (falling edge), irq_ack must be set when that
+* interrupt is shared with other pins. The chip select GPIO is held
+* asserted until the mode is stopped, as DOUT/RDY is high impedance otherwise,
+* so the mode is not available when the SPI controller drives the chip select.
+* Register accesses done meanwhile mask the data ready interrupt and a result
+* completed during such an access is lost. DATA_STAT is set while the mode runs
+* so the interrupt handler can tell new results from stale edges.
+*
+* @param device - The handler of the instance of the driver.
+*
+* @return Returns 0 for success or negative error code.
+*******************************************************************************/
+int32_t AD717X_ContReadStart(ad717x_dev *device)
+{
+	ad717x_st_reg *adcmodeReg;
+	ad717x_st_reg *ifmodeReg;
+	int32_t ret;
+
+	if(!device || !device->regs || !device->irq_desc || !device->gpio_cs ||
+	    device->cont_read)
+		return INVALID_VAL;
+
+	adcmodeReg = AD717X_GetReg(device, AD717X_ADCMODE_REG);
+	ifmodeReg = AD717X_GetReg(device, AD717X_IFMODE_REG);
+	if (!adcmodeReg || !ifmodeReg)
+		return INVALID_VAL;
+
+	device->ring_wr = 0;
+	device->ring_rd = 0;
+	device->ring_overruns = 0;
+	device->ring_stale = 0;
+
+	/* Status byte appended to the data */
+	if (!(ifmodeReg->value & AD717X_IFMODE_REG_DATA_STAT)) {
+		ifmodeReg->value |= AD717X_IFMODE_REG_DATA_STAT;
+		device->cont_read_status = true;
+		ret = AD717X_WriteRegister(device, AD717X_IFMODE_REG);
+		if(ret < 0)
+			goto error_status;
+	}
+
+	/* Continuous conversion mode */
+	adcmodeReg->value &= ~AD717X_ADCMODE_REG_MODE(0x7);
+	ret = AD717X_WriteRegister(device, AD717X_ADCMODE_REG);
+	if(ret < 0)
+		goto error_status;
+
+	ret = irq_register(device->irq_desc, device->irq_id, AD717X_IrqHandler,
+			   device);
+	if(ret < 0)
+		goto error_status;
+
+	ret = gpio_set_value(device->gpio_cs, GPIO_LOW);
+	if(ret < 0)
+		goto error_unregister;
+
+	device->cont_read = true;
+	ret = irq_source_enable(device->irq_desc, device->irq_id);
+	if(ret < 0)
+		goto error_cs;
+
+	return 0;
+
+error_cs:
+	device->cont_read = false;
+	gpio_set_value(device->gpio_cs, GPIO_HIGH);
+error_unregister:
+	irq_unregister(device->irq_desc, device->irq_id);
+error_status:
+	AD717X_ContReadRestoreStatus(device);
+
+	return ret;
+}
+
+/***************************************************************************//**
+* @brief Stops the interrupt driven continuous read mode and releases the chip
+*        select. The ADC keeps its operating mode, the samples left in the ring
+*        can still be read.
+*
+* @param device - The handler of the instance of the driver.
+*
+* @return Returns 0 for success or negative error code.
+*******************************************************************************/
+int32_t AD717X_ContReadStop(ad717x_dev *device)
+{
+	int32_t ret;
+
+	if(!device || !device->cont_read)
+		return INVALID_VAL;
+
+	ret = irq_source_disable(device->irq_desc, device->irq_id);
+	if(ret < 0)
+		return ret;
+
+	device->cont_read = false;
+	ret = irq_unregister(device->irq_desc, device->irq_id);
+	if(ret < 0)
+		return ret;
+
+	ret = gpio_set_value(device->gpio_cs, GPIO_HIGH);
+	if(ret < 0)
+		return ret;
+
+	return AD717X_ContReadRestoreStatus(device);
+}
+
+/***************************************************************************//**
+* @brief Gets the samples captured in continuous read mode.
+*
+* @param device     - The handler of the instance of the driver.
+* @param samples    - Buffer to store the samples, oldest first.
+* @param maxSamples - Size of the buffer in samples.
+*
+* @return Returns the number of samples stored or negative error code.
+*******************************************************************************/
+int32_t AD717X_ContReadSamples(ad717x_dev *device,
+			       ad717x_sample *samples,
+			       uint32_t maxSamples)
+{
+	uint32_t rd, wr;
+	int32_t n = 0;
+
+	if(!device || !samples)
+		return INVALID_VAL;
+
+	rd = device->ring_rd;
+	wr = device->ring_wr;
+	while((rd != wr) && (n < (int32_t)maxSamples)) {
+		samples[n++] = device->ring[rd % AD717X_RING_SIZE];
+		rd++;
+	}
+	device->ring_rd = rd;
+
+	return n;
+}
+
 /***************************************************************************//**
 * @brief Computes data register read size to account for bit number and status
 * 		 read.
@@ -344,23 +581,7 @@ int32_t AD717X_ComputeDataregSize(ad717x_dev *device)
 uint8_t AD717X_ComputeCRC8(uint8_t * pBuf,
 			   uint8_t bufSize)
 {
-	uint8_t i   = 0;
-	uint8_t crc = 0;
-
-	while(bufSize) {
-		for(i = 0x80; i != 0; i >>= 1) {
-			if(((crc & 0x80) != 0) != ((*pBuf & i) !=
-						   0)) { /* MSB of CRC register XOR input Bit from Data */
-				crc <<= 1;
-				crc ^= AD717X_CRC8_POLYNOMIAL_REPRESENTATION;
-			} else {
-				crc <<= 1;
-			}
-		}
-		pBuf++;
-		bufSize--;
-	}
-	return crc;
+	return crc8(crc8_atm_table, pBuf, bufSize, 0);
 }
 
 /***************************************************************************//**
@@ -436,12 +657,34 @@ int32_t AD717X_Init(ad717x_dev **device,
 
 	dev->regs = init_param.regs;
 	dev->num_regs = init_param.num_regs;
+	dev->irq_desc = init_param.irq_desc;
+	dev->irq_id = init_param.irq_id;
+	dev->irq_ack = init_param.irq_ack;
+	dev->irq_ack_ctx = init_param.irq_ack_ctx;
+	dev->cont_read = false;
+	dev->cont_read_status = false;
+	dev->ring_wr = 0;
+	dev->ring_rd = 0;
+	dev->ring_overruns = 0;
+	dev->ring_stale = 0;
 
 	/* Initialize the SPI communication. */
 	ret = spi_init(&dev->spi_desc, &init_param.spi_init);
 	if (ret < 0)
 		return ret;
 
+	/* Initialize the chip select GPIO, deasserted. */
+	dev->gpio_cs = NULL;
+	if (init_param.gpio_cs) {
+		ret = gpio_get(&dev->gpio_cs, init_param.gpio_cs);
+		if (ret < 0)
+			return ret;
+
+		ret = gpio_direction_output(dev->gpio_cs, GPIO_HIGH);
+		if (ret < 0)
+			return ret;
+	}
+
 	/*  Reset the device interface.*/
 	ret = AD717X_Reset(dev);
 	if (ret < 0)
@@ -500,6 +743,9 @@ int32_t AD717X_remove(ad717x_dev *dev)
 
 	ret = spi_remove(dev->spi_desc);
 
+	if (dev->gpio_cs)
+		ret |= gpio_remove(dev->gpio_cs);
+
 	free(dev);
 
 	return ret;
@@ -47,7 +47,10 @@
 /***************************** Include Files **********************************/
 /******************************************************************************/
 #include <stdint.h>
+#include <stdbool.h>
 #include "spi.h"
+#include "gpio.h"
+#include "irq.h"
 
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
@@ -59,6 +62,17 @@ typedef enum {
 	AD717X_USE_XOR,
 } ad717x_crc_mode;
 
+/* Number of samples held by the continuous read ring, a power of 2 */
+#define AD717X_RING_SIZE	128
+
+/*! Conversion result captured in continuous read mode */
+typedef struct {
+	/* Conversion result */
+	int32_t value;
+	/* Channel of the result, from the status byte */
+	uint8_t channel;
+} ad717x_sample;
+
 /*! AD717X register info */
 typedef struct {
 	int32_t addr;
@@ -73,6 +87,27 @@ typedef struct {
  *       provide when calling the Setup() function.
  * @num_regs: The length of the register list.
  * @userCRC: Error check type to use on SPI transfers.
+ * @gpio_cs: GPIO driving the chip select, NULL when it is driven by the SPI
+ *           controller. Required by the continuous read mode, which keeps the
+ *           chip select asserted so DOUT/RDY stays driven.
+ * @irq_desc: Interrupt controller of the data ready line, NULL when the
+ *            continuous read mode is not used.
+ * @irq_id: Interrupt of the GPIO wired to DOUT/RDY, set up by the platform for
+ *          the falling edge.
+ * @irq_ack: Called first by the data ready interrupt handler when irq_id is
+ *           shared by several pins, e.g. the PS GPIO bank interrupt. It must
+ *           clear the interrupt status of the DOUT/RDY pin and return whether
+ *           that pin raised the interrupt. NULL when irq_id is dedicated.
+ * @irq_ack_ctx: Argument passed to irq_ack.
+ * @cont_read: Whether the continuous read mode is running.
+ * @cont_read_status: Whether DATA_STAT was set by the continuous read mode and
+ *                    has to be cleared when it stops.
+ * @ring: Samples read by the data ready interrupt in continuous read mode.
+ * @ring_wr: Number of samples written to the ring.
+ * @ring_rd: Number of samples read from the ring.
+ * @ring_overruns: Number of samples dropped because the ring was full.
+ * @ring_stale: Number of data ready interrupts ignored because the status byte
+ *              reported no new result.
  */
 typedef struct {
 	/* SPI */
@@ -81,6 +116,21 @@ typedef struct {
 	ad717x_st_reg		*regs;
 	uint8_t			num_regs;
 	ad717x_crc_mode		useCRC;
+	/* GPIO */
+	struct gpio_desc	*gpio_cs;
+	/* Data ready interrupt */
+	struct irq_desc		*irq_desc;
+	uint32_t		irq_id;
+	bool			(*irq_ack)(void *ctx);
+	void			*irq_ack_ctx;
+	/* Continuous read */
+	volatile bool		cont_read;
+	bool			cont_read_status;
+	ad717x_sample		ring[AD717X_RING_SIZE];
+	volatile uint32_t	ring_wr;
+	volatile uint32_t	ring_rd;
+	volatile uint32_t	ring_overruns;
+	volatile uint32_t	ring_stale;
 } ad717x_dev;
 
 typedef struct {
@@ -89,6 +139,14 @@ typedef struct {
 	/* Device Settings */
 	ad717x_st_reg		*regs;
 	uint8_t			num_regs;
+	/* GPIO, NULL when the chip select is driven by the SPI controller */
+	struct gpio_init_param	*gpio_cs;
+	/* Data ready interrupt */
+	struct irq_desc		*irq_desc;
+	uint32_t		irq_id;
+	/* DOUT/RDY pin acknowledge, NULL when irq_id is dedicated to the pin */
+	bool			(*irq_ack)(void *ctx);
+	void			*irq_ack_ctx;
 } ad717x_init_param;
 
 /*****************************************************************************/
@@ -309,6 +367,17 @@ int32_t AD717X_WaitForReady(ad717x_dev *device,
 int32_t AD717X_ReadData(ad717x_dev *device,
 			int32_t* pData);
 
+/*! Starts the interrupt driven continuous read mode. */
+int32_t AD717X_ContReadStart(ad717x_dev *device);
+
+/*! Stops the interrupt driven continuous read mode. */
+int32_t AD717X_ContReadStop(ad717x_dev *device);
+
+/*! Gets the samples captured in continuous read mode. */
+int32_t AD717X_ContReadSamples(ad717x_dev *device,
+			       ad717x_sample *samples,
+			       uint32_t maxSamples);
+
 /*! Computes data register read size to account for bit number and status
  *  read. */
 int32_t AD717X_ComputeDataregSize(ad717x_dev *device);
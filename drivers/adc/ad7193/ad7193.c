@@ -74,6 +74,16 @@ int8_t ad7193_init(struct ad7193_dev **device,
 
 	dev->current_polarity = init_param.current_polarity;
 	dev->current_gain = init_param.current_gain;
+	dev->irq_desc = init_param.irq_desc;
+	dev->irq_id = init_param.irq_id;
+	dev->irq_ack = init_param.irq_ack;
+	dev->irq_ack_ctx = init_param.irq_ack_ctx;
+	dev->cont_read = false;
+	dev->cont_read_status = false;
+	dev->ring_wr = 0;
+	dev->ring_rd = 0;
+	dev->ring_overruns = 0;
+	dev->ring_stale = 0;
 
 	/* SPI */
 	status = spi_init(&dev->spi_desc, &init_param.spi_init);
@@ -122,6 +132,42 @@ int32_t ad7193_remove(struct ad7193_dev *dev)
 	return status;
 }
 
+/***************************************************************************//**
+ * @brief Writes and reads data to/from the device.
+ *
+ * The chip select is asserted for the transfer only when allowed. In
+ * continuous read mode it is already held asserted and the data ready
+ * interrupt is masked instead, as DOUT/RDY toggles with the data read out.
+ *
+ * @param dev          - The device structure.
+ * @param data         - Data to be written, replaced by the data read.
+ * @param bytes_number - Number of bytes to transfer.
+ * @param modify_cs    - Allows Chip Select to be modified.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+*******************************************************************************/
+static int32_t ad7193_spi_write_and_read(struct ad7193_dev *dev,
+		uint8_t *data,
+		uint8_t bytes_number,
+		uint8_t modify_cs)
+{
+	int32_t ret;
+
+	if (dev->cont_read)
+		irq_source_disable(dev->irq_desc, dev->irq_id);
+	else if (modify_cs)
+		AD7193_CS_LOW;
+
+	ret = spi_write_and_read(dev->spi_desc, data, bytes_number);
+
+	if (dev->cont_read)
+		irq_source_enable(dev->irq_desc, dev->irq_id);
+	else if (modify_cs)
+		AD7193_CS_HIGH;
+
+	return ret;
+}
+
 /***************************************************************************//**
  * @brief Writes data into a register.
  *
@@ -150,11 +196,8 @@ void ad7193_set_register_value(struct ad7193_dev *dev,
 		data_pointer ++;
 		bytes_nr --;
 	}
-	if (modify_cs)
-		AD7193_CS_LOW;
-	spi_write_and_read(dev->spi_desc, write_command, bytes_number + 1);
-	if (modify_cs)
-		AD7193_CS_HIGH;
+	ad7193_spi_write_and_read(dev, write_command, bytes_number + 1,
+				  modify_cs);
 }
 
 /***************************************************************************//**
@@ -178,11 +221,8 @@ uint32_t ad7193_get_register_value(struct ad7193_dev *dev,
 
 	register_word[0] = AD7193_COMM_READ |
 			   AD7193_COMM_ADDR(register_address);
-	if (modify_cs)
-		AD7193_CS_LOW;
-	spi_write_and_read(dev->spi_desc, register_word, bytes_number + 1);
-	if (modify_cs)
-		AD7193_CS_HIGH;
+	ad7193_spi_write_and_read(dev, register_word, bytes_number + 1,
+				  modify_cs);
 	for(i = 1; i < bytes_number + 1; i++) {
 		buffer = (buffer << 8) + register_word[i];
 	}
@@ -207,7 +247,7 @@ void ad7193_reset(struct ad7193_dev *dev)
 	register_word[3] = 0xFF;
 	register_word[4] = 0xFF;
 	register_word[5] = 0xFF;
-	spi_write_and_read(dev->spi_desc, register_word, 6);
+	ad7193_spi_write_and_read(dev, register_word, 6, 0);
 }
 
 /***************************************************************************//**
@@ -425,6 +465,199 @@ uint32_t ad7193_continuous_read_avg(struct ad7193_dev *dev,
 	return samples_average;
 }
 
+/***************************************************************************//**
+ * @brief Data ready interrupt handler, reads the conversion result and stores
+ *        it in the continuous read ring.
+ *
+ * The status byte is appended to the data in continuous read mode and a read
+ * whose RDY bit is set is dropped, as it was triggered by a stale edge and
+ * returns the previous result again.
+ *
+ * @param data - The device structure.
+ *
+ * @return none.
+*******************************************************************************/
+static void ad7193_irq_handler(void *data)
+{
+	struct ad7193_dev *dev = data;
+	struct ad7193_sample *sample;
+	uint32_t wr = dev->ring_wr;
+	uint32_t reg_data;
+
+	if (dev->irq_ack && !dev->irq_ack(dev->irq_ack_ctx))
+		return;
+
+	reg_data = ad7193_get_register_value(dev,
+					     AD7193_REG_DATA,
+					     4,
+					     0); // CS is not modified.
+	if (reg_data & AD7193_STAT_RDY) {
+		dev->ring_stale++;
+		return;
+	}
+
+	if (wr - dev->ring_rd < AD7193_RING_SIZE) {
+		sample = &dev->ring[wr % AD7193_RING_SIZE];
+		sample->channel = reg_data & (AD7193_STAT_CH3 |
+					      AD7193_STAT_CH2 |
+					      AD7193_STAT_CH1 |
+					      AD7193_STAT_CH0);
+		sample->value = reg_data >> 8;
+		dev->ring_wr = wr + 1;
+	} else {
+		dev->ring_overruns++;
+	}
+}
+
+/***************************************************************************//**
+ * @brief Clears DAT_STA if it was set by ad7193_cont_read_start().
+ *
+ * @param dev - The device structure.
+ *
+ * @return none.
+*******************************************************************************/
+static void ad7193_cont_read_restore_status(struct ad7193_dev *dev)
+{
+	uint32_t mode;
+
+	if (!dev->cont_read_status)
+		return;
+
+	dev->cont_read_status = false;
+	mode = ad7193_get_register_value(dev,
+					 AD7193_REG_MODE,
+					 3,
+					 1);
+	ad7193_set_register_value(dev,
+				  AD7193_REG_MODE,
+				  mode & ~AD7193_MODE_DAT_STA,
+				  3,
+				  1);
+}
+
+/***************************************************************************//**
+ * @brief Starts the interrupt driven continuous read mode.
+ *
+ * The ADC is put in continuous conversion mode with the chip select held low
+ * and every result is read by the data ready interrupt, so RDY is not polled.
+ * DOUT/RDY must be wired to the irq_id GPIO interrupt (falling edge), irq_ack
+ * must be set when that interrupt is shared with other pins. Register accesses
+ * done meanwhile mask the data ready interrupt and a result completed during
+ * such an access is lost. DAT_STA is set while the mode runs so the interrupt
+ * handler can tell new results from stale edges.
+ *
+ * @param dev - The device structure.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+*******************************************************************************/
+int32_t ad7193_cont_read_start(struct ad7193_dev *dev)
+{
+	uint32_t mode;
+	int32_t ret;
+
+	if (!dev || !dev->irq_desc || dev->cont_read)
+		return -1;
+
+	dev->ring_wr = 0;
+	dev->ring_rd = 0;
+	dev->ring_overruns = 0;
+	dev->ring_stale = 0;
+
+	mode = ad7193_get_register_value(dev,
+					 AD7193_REG_MODE,
+					 3,
+					 1);
+	mode &= ~AD7193_MODE_SEL(0x7);
+	mode |= AD7193_MODE_SEL(AD7193_MODE_CONT);
+	dev->cont_read_status = !(mode & AD7193_MODE_DAT_STA);
+	mode |= AD7193_MODE_DAT_STA;
+
+	ret = irq_register(dev->irq_desc, dev->irq_id, ad7193_irq_handler, dev);
+	if (ret < 0) {
+		dev->cont_read_status = false;
+		return ret;
+	}
+
+	AD7193_CS_LOW;
+	ad7193_set_register_value(dev,
+				  AD7193_REG_MODE,
+				  mode,
+				  3,
+				  0); // CS is not modified.
+
+	dev->cont_read = true;
+	ret = irq_source_enable(dev->irq_desc, dev->irq_id);
+	if (ret < 0)
+		goto error;
+
+	return 0;
+
+error:
+	dev->cont_read = false;
+	AD7193_CS_HIGH;
+	irq_unregister(dev->irq_desc, dev->irq_id);
+	ad7193_cont_read_restore_status(dev);
+
+	return ret;
+}
+
+/***************************************************************************//**
+ * @brief Stops the interrupt driven continuous read mode and releases the chip
+ *        select. The samples left in the ring can still be read.
+ *
+ * @param dev - The device structure.
+ *
+ * @return 0 in case of success, negative error code otherwise.
+*******************************************************************************/
+int32_t ad7193_cont_read_stop(struct ad7193_dev *dev)
+{
+	int32_t ret;
+
+	if (!dev || !dev->cont_read)
+		return -1;
+
+	ret = irq_source_disable(dev->irq_desc, dev->irq_id);
+	if (ret < 0)
+		return ret;
+
+	dev->cont_read = false;
+	ret = irq_unregister(dev->irq_desc, dev->irq_id);
+	AD7193_CS_HIGH;
+	ad7193_cont_read_restore_status(dev);
+
+	return ret;
+}
+
+/***************************************************************************//**
+ * @brief Gets the samples captured in continuous read mode.
+ *
+ * @param dev         - The device structure.
+ * @param samples     - Buffer to store the samples, oldest first.
+ * @param max_samples - Size of the buffer in samples.
+ *
+ * @return The number of samples stored, negative error code otherwise.
+*******************************************************************************/
+int32_t ad7193_cont_read_samples(struct ad7193_dev *dev,
+				 struct ad7193_sample *samples,
+				 uint32_t max_samples)
+{
+	uint32_t rd, wr;
+	int32_t n = 0;
+
+	if (!dev || !samples)
+		return -1;
+
+	rd = dev->ring_rd;
+	wr = dev->ring_wr;
+	while ((rd != wr) && (n < (int32_t)max_samples)) {
+		samples[n++] = dev->ring[rd % AD7193_RING_SIZE];
+		rd++;
+	}
+	dev->ring_rd = rd;
+
+	return n;
+}
+
 /***************************************************************************//**
  * @brief Read data from temperature sensor and converts it to Celsius degrees.
  *
@@ -44,8 +44,10 @@
 /***************************** Include Files **********************************/
 /******************************************************************************/
 #include <stdint.h>
+#include <stdbool.h>
 #include "gpio.h"
 #include "spi.h"
+#include "irq.h"
 
 /******************************************************************************/
 /******************************** AD7193 **************************************/
@@ -175,10 +177,21 @@
 #define AD7193_GPOCON_P1DAT     (1 << 1) // P1 state
 #define AD7193_GPOCON_P0DAT     (1 << 0) // P0 state
 
+/* Number of samples held by the continuous read ring, a power of 2 */
+#define AD7193_RING_SIZE	128
+
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
 
+/* Conversion result captured in continuous read mode */
+struct ad7193_sample {
+	/* Conversion result */
+	uint32_t	value;
+	/* Channel of the result, from the status byte */
+	uint8_t		channel;
+};
+
 struct ad7193_dev {
 	/* SPI */
 	spi_desc	*spi_desc;
@@ -188,6 +201,22 @@ struct ad7193_dev {
 	/* Device Settings */
 	uint8_t		current_polarity;
 	uint8_t		current_gain;
+	/* Data ready interrupt, of the GPIO wired to DOUT/RDY (falling edge) */
+	struct irq_desc	*irq_desc;
+	uint32_t	irq_id;
+	/* DOUT/RDY pin acknowledge, NULL when irq_id is dedicated to the pin */
+	bool		(*irq_ack)(void *ctx);
+	void		*irq_ack_ctx;
+	/* Continuous read */
+	volatile bool	cont_read;
+	/* DAT_STA was set by the continuous read and is cleared when it stops */
+	bool		cont_read_status;
+	struct ad7193_sample	ring[AD7193_RING_SIZE];
+	volatile uint32_t	ring_wr;
+	volatile uint32_t	ring_rd;
+	volatile uint32_t	ring_overruns;
+	/* Data ready interrupts ignored as the status reported no new result */
+	volatile uint32_t	ring_stale;
 };
 
 struct ad7193_init_param {
@@ -199,6 +228,17 @@ struct ad7193_init_param {
 	/* Device Settings */
 	uint8_t		current_polarity;
 	uint8_t		current_gain;
+	/* Data ready interrupt, NULL when the continuous read is not used */
+	struct irq_desc	*irq_desc;
+	uint32_t	irq_id;
+	/*
+	 * Called first by the data ready interrupt handler when irq_id is shared
+	 * by several pins, e.g. the PS GPIO bank interrupt. It must clear the
+	 * interrupt status of the DOUT/RDY pin and return whether that pin raised
+	 * the interrupt. NULL when irq_id is dedicated to the pin.
+	 */
+	bool		(*irq_ack)(void *ctx);
+	void		*irq_ack_ctx;
 };
 
 /******************************************************************************/
@@ -256,6 +296,17 @@ uint32_t ad7193_single_conversion(struct ad7193_dev *dev);
 uint32_t ad7193_continuous_read_avg(struct ad7193_dev *dev,
 				    uint8_t sample_number);
 
+/*! Starts the interrupt driven continuous read mode. */
+int32_t ad7193_cont_read_start(struct ad7193_dev *dev);
+
+/*! Stops the interrupt driven continuous read mode. */
+int32_t ad7193_cont_read_stop(struct ad7193_dev *dev);
+
+/*! Gets the samples captured in continuous read mode. */
+int32_t ad7193_cont_read_samples(struct ad7193_dev *dev,
+				 struct ad7193_sample *samples,
+				 uint32_t max_samples);
+
 /*! Read data from temperature sensor and converts it to Celsius degrees. */
 float ad7193_temperature_read(struct ad7193_dev *dev);
 
@@ -44,6 +44,14 @@
 /******************************************************************************/
 #include <stdlib.h>
 #include "ad7280a.h"
+#include "crc8.h"
+
+/******************************************************************************/
+/************************ Variables Definitions *******************************/
+/******************************************************************************/
+
+/* Lookup table of AD7280A_CRC8_POLY, filled by ad7280a_init() */
+DECLARE_CRC8_TABLE(ad7280a_crc8_table);
 
 /*****************************************************************************/
 /************************ Functions Definitions ******************************/
@@ -71,6 +79,8 @@ int8_t ad7280a_init(struct ad7280a_dev **device,
 	if (!dev)
 		return -1;
 
+	crc8_populate_msb(ad7280a_crc8_table, AD7280A_CRC8_POLY);
+
 	/* GPIO */
 	status = gpio_get(&dev->gpio_pd, &init_param.gpio_pd);
 	status |= gpio_get(&dev->gpio_cnvst, &init_param.gpio_cnvst);
@@ -170,6 +180,25 @@ uint32_t ad7280a_transfer_32bits(struct ad7280a_dev *dev,
 	return received_data;
 }
 
+/******************************************************************************
+ * @brief Computes the CRC of up to 24 bits of a message, as the shift register
+ *        of the device (the data bits enter at the CRC LSB): the CRC of the
+ *        upper bytes XOR the last byte.
+ *
+ * @param value : The bits covered by the CRC, right aligned
+ *
+ * @return The CRC
+******************************************************************************/
+static uint8_t ad7280a_calc_crc8(uint32_t value)
+{
+	uint8_t buf[2];
+
+	buf[0] = (value >> 16) & 0xFF;
+	buf[1] = (value >> 8) & 0xFF;
+
+	return crc8(ad7280a_crc8_table, buf, 2, 0) ^ (value & 0xFF);
+}
+
 /******************************************************************************
  * @brief Computes the CRC value for a write transmission, and prepares the
  *        complete write codeword
@@ -181,45 +210,12 @@ uint32_t ad7280a_transfer_32bits(struct ad7280a_dev *dev,
 ******************************************************************************/
 uint32_t ad7280a_crc_write(uint32_t message)
 {
-	int32_t i;
-	int32_t crc;
-	int32_t xor1 = 0;
-	int32_t xor2 = 0;
-	int32_t xor3 = 0;
-	int32_t xor4 = 0;
-	int32_t xor5 = 0;
-	uint32_t data_out = 0;
-	int32_t crc0 = 0;
-	int32_t crc1 = 0;
-	int32_t crc2 = 0;
-	int32_t crc3 = 0;
-	int32_t crc4 = 0;
-	int32_t crc5 = 0;
-	int32_t crc6 = 0;
-	int32_t crc7 = 0;
+	uint32_t crc;
 
 	message = message >> 11;
-	for (i = NUMBITS_WRITE; i >= 0; i--) {
-		xor5 = (crc4 ^ crc7) ? 1 : 0;
-		xor4 = (crc2 ^ crc7) ? 1 : 0;
-		xor3 = (crc1 ^ crc7) ? 1 : 0;
-		xor2 = (crc0 ^ crc7) ? 1 : 0;
-		xor1 = ((message & (1 << i)) ? 1 : 0) ^ (crc7 ? 1 : 0);
-		crc7 = crc6;
-		crc6 = crc5;
-		crc5 = xor5;
-		crc4 = crc3;
-		crc3 = xor4;
-		crc2 = xor3;
-		crc1 = xor2;
-		crc0 = xor1;
-	}
-	crc = (crc0 ? (1 << 0) : 0) | (crc1 ? (1 << 1) : 0) | (crc2 ? (1 << 2) : 0) |
-	      (crc3 ? (1 << 3) : 0) | (crc4 ? (1 << 4) : 0) | (crc5 ? (1 << 5) : 0) |
-	      (crc6 ? (1 << 6) : 0) | (crc7 ? (1 << 7) : 0);
-	data_out = (message << 11) | (crc << 3) | 2;
+	crc = ad7280a_calc_crc8(message);
 
-	return data_out;
+	return (message << 11) | (crc << 3) | 2;
 }
 
 /******************************************************************************
@@ -233,50 +229,11 @@ uint32_t ad7280a_crc_write(uint32_t message)
 ******************************************************************************/
 int32_t ad7280a_crc_read(uint32_t message)
 {
-	int32_t i;
-	uint32_t data_in = 0;
-	int32_t crc_rec;
-	int32_t crc_computed;
-	int32_t xor1 = 0;
-	int32_t xor2 = 0;
-	int32_t xor3 = 0;
-	int32_t xor4 = 0;
-	int32_t xor5 = 0;
-	int32_t crc0 = 0;
-	int32_t crc1 = 0;
-	int32_t crc2 = 0;
-	int32_t crc3 = 0;
-	int32_t crc4 = 0;
-	int32_t crc5 = 0;
-	int32_t crc6 = 0;
-	int32_t crc7 = 0;
-
-	crc_rec= (message >> 2) & 0xFF;
-	data_in = message >> 10;
-	for (i = NUMBITS_READ; i >= 0; i--) {
-		xor5 = (crc4 ^ crc7) ? 1 : 0;
-		xor4 = (crc2 ^ crc7) ? 1 : 0;
-		xor3 = (crc1 ^ crc7) ? 1 : 0;
-		xor2 = (crc0 ^ crc7) ? 1 : 0;
-		xor1 = ((data_in & (1 << i)) ? 1 : 0) ^ (crc7 ? 1 : 0);
-		crc7 = crc6;
-		crc6 = crc5;
-		crc5 = xor5;
-		crc4 = crc3;
-		crc3 = xor4;
-		crc2 = xor3;
-		crc1 = xor2;
-		crc0 = xor1;
-	}
-	crc_computed = (crc0 ? (1 << 0) : 0) | (crc1 ? (1 << 1) : 0) |
-		       (crc2 ? (1 << 2) : 0) | (crc3 ? (1 << 3) : 0) |
-		       (crc4 ? (1 << 4) : 0) | (crc5 ? (1 << 5) : 0) |
-		       (crc6 ? (1 << 6) : 0) | (crc7 ? (1 << 7) : 0);
-	if (crc_rec == crc_computed) {
-		return 1;
-	} else {
-		return 0;
-	}
+	uint8_t crc_rec;
+
+	crc_rec = (message >> 2) & 0xFF;
+
+	return (crc_rec == ad7280a_calc_crc8(message >> 10)) ? 1 : 0;
 }
 
 /******************************************************************************
@@ -52,6 +52,9 @@
 /******************************************************************************/
 /********************** Macros and Constants Definitions **********************/
 /******************************************************************************/
+/* Number of 32-bit words staged on the stack per axi_io_write_block() call */
+#define AXI_DAC_BLOCK_SIZE				256
+
 #define AXI_DAC_REG_RSTN				0x40
 #define AXI_DAC_MMCM_RSTN				BIT(1)
 #define AXI_DAC_RSTN					BIT(0)
@@ -685,11 +688,15 @@ int32_t axi_dac_dds_get_calib_phase(struct axi_dac *dac,
 
 /***************************************************************************//**
  * @brief axi_dac_set_sine_lut
+ * @return The length of the loaded data in bytes, negative error code if
+ *         writing it failed.
 *******************************************************************************/
-uint32_t axi_dac_set_sine_lut(struct axi_dac *dac,
-			      uint32_t address)
+int32_t axi_dac_set_sine_lut(struct axi_dac *dac,
+			     uint32_t address)
 {
+	uint32_t buff[ARRAY_SIZE(sine_lut) * 2];
 	uint32_t length;
+	int32_t ret;
 	uint32_t tx_count;
 	uint32_t index_mem;
 	uint32_t index;
@@ -712,7 +719,7 @@ uint32_t axi_dac_set_sine_lut(struct axi_dac *dac,
 			data_i1 = (sine_lut[index_i1 / 2] << 20);
 			data_q1 = (sine_lut[index_q1 / 2] << 4);
 
-			axi_io_write(address, index_mem * 4, data_i1 | data_q1);
+			buff[index_mem] = data_i1 | data_q1;
 
 			index_i2 = index_i1;
 			index_q2 = index_q1;
@@ -723,9 +730,12 @@ uint32_t axi_dac_set_sine_lut(struct axi_dac *dac,
 			data_i2 = (sine_lut[index_i2 / 2] << 20);
 			data_q2 = (sine_lut[index_q2 / 2] << 4);
 
-			axi_io_write(address, (index_mem + 1) * 4, data_i2 | data_q2);
+			buff[index_mem + 1] = data_i2 | data_q2;
 
 		}
+		ret = axi_io_write_block(address, 0, buff, tx_count * 2);
+		if (ret != SUCCESS)
+			return ret;
 	} else {
 		for(index = 0; index < tx_count; index += 1) {
 			index_i1 = index;
@@ -735,8 +745,11 @@ uint32_t axi_dac_set_sine_lut(struct axi_dac *dac,
 			data_i1 = (sine_lut[index_i1] << 20);
 			data_q1 = (sine_lut[index_q1] << 4);
 
-			axi_io_write(address, index * 4, data_i1 | data_q1);
+			buff[index] = data_i1 | data_q1;
 		}
+		ret = axi_io_write_block(address, 0, buff, tx_count);
+		if (ret != SUCCESS)
+			return ret;
 	}
 
 	length = tx_count * dac->num_channels * 2;
@@ -769,15 +782,26 @@ int32_t axi_dac_set_buff(struct axi_dac *dac,
 			 uint16_t *buff,
 			 uint32_t buff_size)
 {
+	uint32_t block[AXI_DAC_BLOCK_SIZE];
 	uint32_t index;
+	uint32_t count = 0;
+	uint32_t offset = 0;
 	uint32_t data_i;
 	uint32_t data_q;
+	int32_t ret;
 
 	for(index = 0; index < buff_size; index += 2) {
 		data_i = (buff[index]);
 		data_q = (buff[index + 1] << 16);
 
-		axi_io_write(address, index * 2, data_i | data_q);
+		block[count++] = data_i | data_q;
+		if ((count == AXI_DAC_BLOCK_SIZE) || (index + 2 >= buff_size)) {
+			ret = axi_io_write_block(address, offset, block, count);
+			if (ret != SUCCESS)
+				return ret;
+			offset += count * sizeof(block[0]);
+			count = 0;
+		}
 	}
 
 	return SUCCESS;
@@ -791,18 +815,36 @@ int32_t axi_dac_load_custom_data(struct axi_dac *dac,
 				 uint32_t custom_tx_count,
 				 uint32_t address)
 {
-	uint32_t index, index_mem = 0;
+	uint32_t block[AXI_DAC_BLOCK_SIZE];
+	uint32_t index, count = 0, offset = 0;
 	uint8_t chan;
 	uint8_t num_tx_channels = dac->num_channels / 2;
+	int32_t ret;
 
-	for(index = 0; index < custom_tx_count; index++) {
-		/* Send the same data on all the channels */
-		for (chan = 0; chan < num_tx_channels; chan++) {
-
-			axi_io_write(address, index_mem * sizeof(uint32_t),
-				     custom_data_iq[index]);
-
-			index_mem++;
+	if (num_tx_channels <= 1) {
+		ret = axi_io_write_block(address, 0, custom_data_iq,
+					 custom_tx_count);
+		if (ret != SUCCESS)
+			return ret;
+	} else {
+		for(index = 0; index < custom_tx_count; index++) {
+			/* Send the same data on all the channels */
+			for (chan = 0; chan < num_tx_channels; chan++) {
+				block[count++] = custom_data_iq[index];
+				if (count < AXI_DAC_BLOCK_SIZE)
+					continue;
+				ret = axi_io_write_block(address, offset, block,
+							 count);
+				if (ret != SUCCESS)
+					return ret;
+				offset += count * sizeof(block[0]);
+				count = 0;
+			}
+		}
+		if (count) {
+			ret = axi_io_write_block(address, offset, block, count);
+			if (ret != SUCCESS)
+				return ret;
 		}
 	}
 
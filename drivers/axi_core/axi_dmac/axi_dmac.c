@@ -42,11 +42,24 @@
 /******************************************************************************/
 #include <stdlib.h>
 #include <stdio.h>
+#include <errno.h>
 #include "axi_io.h"
 #include "error.h"
-#include "delay.h"
+#include "poll_timeout.h"
 #include "axi_dmac.h"
 
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/** Context of the poll_timeout() conditions */
+struct axi_dmac_poll {
+	struct axi_dmac *dmac;
+	struct axi_dmac_xfer *xfer;
+	struct axi_dmac_stream *stream;
+	struct axi_dmac_stream_buf *buf;
+};
+
 /***************************************************************************//**
  * @brief axi_dmac_read
  *******************************************************************************/
@@ -72,60 +85,606 @@ int32_t axi_dmac_write(struct axi_dmac *dmac,
 }
 
 /***************************************************************************//**
- * @brief axi_dmac_transfer
+ * @brief axi_dmac_lock
+ * Keep the DMAC interrupt masked while the transfer bookkeeping is updated
+ * outside of the IRQ handler. Calls may be nested.
  *******************************************************************************/
-int32_t axi_dmac_transfer(struct axi_dmac *dmac,
-			  uint32_t address, uint32_t size)
+static void axi_dmac_lock(struct axi_dmac *dmac)
+{
+	if (dmac->irq_en && !dmac->lock++)
+		axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_MASK,
+			       AXI_DMAC_IRQ_SOT | AXI_DMAC_IRQ_EOT);
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_unlock
+ *******************************************************************************/
+static void axi_dmac_unlock(struct axi_dmac *dmac)
+{
+	if (dmac->irq_en && !--dmac->lock)
+		axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_MASK, AXI_DMAC_IRQ_SOT);
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_complete
+ * Retire, in submission order, the queued transfers reported as done by the
+ * hardware and call their completion callbacks.
+ *******************************************************************************/
+static void axi_dmac_complete(struct axi_dmac *dmac)
 {
+	struct axi_dmac_xfer *xfer;
+	uint32_t snapshot = 0;
+	uint32_t done;
+
+	while (dmac->queued & BIT(dmac->next_done)) {
+		/* Snapshot the hardware once per pass, before the callbacks
+		 * queue transfers, possibly reusing the retired IDs. */
+		if (!snapshot) {
+			axi_dmac_read(dmac, AXI_DMAC_REG_TRANSFER_DONE, &done);
+			snapshot = dmac->queued;
+		}
+		xfer = &dmac->xfers[dmac->next_done];
+		if (!(done & BIT(xfer->id)))
+			break;
+
+		dmac->queued &= ~BIT(xfer->id);
+		snapshot &= ~BIT(xfer->id);
+		dmac->next_done = (dmac->next_done + 1) % AXI_DMAC_MAX_TRANSFERS;
+		xfer->state = AXI_DMAC_XFER_DONE;
+		/* Nothing was queued behind it when the snapshot was taken. */
+		xfer->idle = !snapshot;
+		if (xfer->complete)
+			xfer->complete(dmac, xfer, xfer->ctx);
+	}
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_irq_handler
+ * DMAC interrupt handler, to be registered through irq_register() with the
+ * DMAC instance as argument.
+ *******************************************************************************/
+void axi_dmac_irq_handler(void *data)
+{
+	struct axi_dmac *dmac = data;
+	uint32_t reg_val;
+
+	axi_dmac_read(dmac, AXI_DMAC_REG_IRQ_PENDING, &reg_val);
+	axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_PENDING, reg_val);
+
+	if (reg_val & AXI_DMAC_IRQ_EOT)
+		axi_dmac_complete(dmac);
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_queue
+ * Program a 2D transfer of y_length rows of x_length bytes, with rows placed
+ * stride bytes apart in memory, and queue it.
+ *******************************************************************************/
+static int32_t axi_dmac_queue(struct axi_dmac *dmac,
+			      const struct axi_dmac_xfer_2d *desc,
+			      void (*complete)(struct axi_dmac *dmac,
+					       struct axi_dmac_xfer *xfer,
+					       void *ctx),
+			      void *ctx,
+			      struct axi_dmac_xfer **xfer)
+{
+	struct axi_dmac_xfer *x;
 	uint32_t transfer_id;
 	uint32_t reg_val;
+	int32_t ret = FAILURE;
 
-	axi_dmac_write(dmac, AXI_DMAC_REG_CTRL, 0x0);
-	axi_dmac_write(dmac, AXI_DMAC_REG_CTRL, AXI_DMAC_CTRL_ENABLE);
+	if (!desc->x_length || !desc->y_length)
+		return FAILURE;
+	if ((desc->y_length > 1) && !dmac->hw_2d)
+		return FAILURE;
+
+	axi_dmac_lock(dmac);
+
+	if (!dmac->queued) {
+		axi_dmac_write(dmac, AXI_DMAC_REG_CTRL, 0x0);
+		axi_dmac_write(dmac, AXI_DMAC_REG_CTRL, AXI_DMAC_CTRL_ENABLE);
+
+		if (!dmac->irq_en)
+			axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_MASK, 0x0);
+
+		axi_dmac_read(dmac, AXI_DMAC_REG_IRQ_PENDING, &reg_val);
+		axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_PENDING, reg_val);
+	}
 
-	axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_MASK, 0x0);
+	/* No free slot in the hardware queue. */
+	axi_dmac_read(dmac, AXI_DMAC_REG_START_TRANSFER, &reg_val);
+	if (reg_val)
+		goto unlock;
 
 	axi_dmac_read(dmac, AXI_DMAC_REG_TRANSFER_ID, &transfer_id);
-	axi_dmac_read(dmac, AXI_DMAC_REG_IRQ_PENDING, &reg_val);
-	axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_PENDING, reg_val);
+	transfer_id %= AXI_DMAC_MAX_TRANSFERS;
+	if (dmac->queued & BIT(transfer_id))
+		goto unlock;
+	if (!dmac->queued)
+		dmac->next_done = transfer_id;
 
 	switch (dmac->direction) {
 	case DMA_DEV_TO_MEM:
-		axi_dmac_write(dmac, AXI_DMAC_REG_DEST_ADDRESS, address);
-		axi_dmac_write(dmac, AXI_DMAC_REG_DEST_STRIDE, 0x0);
+		axi_dmac_write(dmac, AXI_DMAC_REG_DEST_ADDRESS, desc->address);
+		axi_dmac_write(dmac, AXI_DMAC_REG_DEST_STRIDE, desc->stride);
 		break;
 	case DMA_MEM_TO_DEV:
-		axi_dmac_write(dmac, AXI_DMAC_REG_SRC_ADDRESS, address);
-		axi_dmac_write(dmac, AXI_DMAC_REG_SRC_STRIDE, 0x0);
+		axi_dmac_write(dmac, AXI_DMAC_REG_SRC_ADDRESS, desc->address);
+		axi_dmac_write(dmac, AXI_DMAC_REG_SRC_STRIDE, desc->stride);
 		break;
 	default:
-		return FAILURE; // Other directions are not supported yet
+		goto unlock; // Other directions are not supported yet
 	}
-	axi_dmac_write(dmac, AXI_DMAC_REG_X_LENGTH, size - 1);
-	axi_dmac_write(dmac, AXI_DMAC_REG_Y_LENGTH, 0x0);
+	axi_dmac_write(dmac, AXI_DMAC_REG_X_LENGTH, desc->x_length - 1);
+	if (dmac->hw_2d)
+		axi_dmac_write(dmac, AXI_DMAC_REG_Y_LENGTH, desc->y_length - 1);
 
 	axi_dmac_write(dmac, AXI_DMAC_REG_FLAGS, dmac->flags);
 
+	x = &dmac->xfers[transfer_id];
+	x->id = transfer_id;
+	x->address = desc->address;
+	x->size = desc->x_length * desc->y_length;
+	x->complete = complete;
+	x->ctx = ctx;
+	x->state = AXI_DMAC_XFER_QUEUED;
+	dmac->queued |= BIT(transfer_id);
+
 	axi_dmac_write(dmac, AXI_DMAC_REG_START_TRANSFER, 0x1);
 
+	if (xfer)
+		*xfer = x;
+
+	ret = SUCCESS;
+unlock:
+	axi_dmac_unlock(dmac);
+
+	return ret;
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_transfer_submit
+ * Queue a transfer and return without waiting for it. Up to
+ * AXI_DMAC_MAX_TRANSFERS transfers may be outstanding. Without IRQ the
+ * completed transfers are retired by axi_dmac_transfer_done() and
+ * axi_dmac_transfer_wait().
+ *******************************************************************************/
+int32_t axi_dmac_transfer_submit(struct axi_dmac *dmac,
+				 uint32_t address, uint32_t size,
+				 void (*complete)(struct axi_dmac *dmac,
+						 struct axi_dmac_xfer *xfer,
+						 void *ctx),
+				 void *ctx,
+				 struct axi_dmac_xfer **xfer)
+{
+	struct axi_dmac_xfer_2d desc = {
+		.address = address,
+		.x_length = size,
+		.y_length = 1,
+		.stride = 0,
+	};
+
+	return axi_dmac_queue(dmac, &desc, complete, ctx, xfer);
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_transfer_submit_2d
+ * Queue a 2D transfer, see axi_dmac_transfer_submit(). Needs a DMAC built
+ * with 2D transfer support.
+ *******************************************************************************/
+int32_t axi_dmac_transfer_submit_2d(struct axi_dmac *dmac,
+				    const struct axi_dmac_xfer_2d *desc,
+				    void (*complete)(struct axi_dmac *dmac,
+						    struct axi_dmac_xfer *xfer,
+						    void *ctx),
+				    void *ctx,
+				    struct axi_dmac_xfer **xfer)
+{
+	if (desc->stride < desc->x_length)
+		return FAILURE;
+
+	return axi_dmac_queue(dmac, desc, complete, ctx, xfer);
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_transfer_done
+ *******************************************************************************/
+bool axi_dmac_transfer_done(struct axi_dmac *dmac,
+			    struct axi_dmac_xfer *xfer)
+{
+	if (!dmac->irq_en && (xfer->state == AXI_DMAC_XFER_QUEUED))
+		axi_dmac_complete(dmac);
+
+	return xfer->state != AXI_DMAC_XFER_QUEUED;
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_poll
+ * Poll a condition for timeout_ms, forever for AXI_DMAC_TIMEOUT_INFINITE.
+ * poll_timeout() counts microseconds on 32 bits, longer timeouts are done in
+ * several rounds.
+ *******************************************************************************/
+static int32_t axi_dmac_poll(int32_t (*cond)(void *ctx),
+			     struct axi_dmac_poll *poll,
+			     uint32_t timeout_ms)
+{
+	const uint32_t round_ms = UINT32_MAX / 1000;
+	uint32_t ms;
+	int32_t ret;
+
+	do {
+		ms = (timeout_ms > round_ms) ? round_ms : timeout_ms;
+		ret = poll_timeout(cond, poll, ms * 1000);
+		if (ret != -ETIMEDOUT)
+			return ret;
+		if (timeout_ms != AXI_DMAC_TIMEOUT_INFINITE)
+			timeout_ms -= ms;
+	} while (timeout_ms);
+
+	return ret;
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_transfer_done_cond
+ * poll_timeout() condition of axi_dmac_transfer_wait().
+ *******************************************************************************/
+static int32_t axi_dmac_transfer_done_cond(void *ctx)
+{
+	struct axi_dmac_poll *poll = ctx;
+
+	return axi_dmac_transfer_done(poll->dmac, poll->xfer);
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_transfer_wait
+ * Wait for a transfer to complete. In IRQ mode the completion is signalled
+ * by axi_dmac_irq_handler(), otherwise the hardware is polled.
+ *******************************************************************************/
+int32_t axi_dmac_transfer_wait(struct axi_dmac *dmac,
+			       struct axi_dmac_xfer *xfer,
+			       uint32_t timeout_ms)
+{
+	struct axi_dmac_poll poll = {
+		.dmac = dmac,
+		.xfer = xfer
+	};
+
+	if (axi_dmac_poll(axi_dmac_transfer_done_cond, &poll,
+			  timeout_ms) != SUCCESS)
+		return FAILURE;
+
+	return xfer->state == AXI_DMAC_XFER_DONE ? SUCCESS : FAILURE;
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_transfer_stop
+ * Stop the DMAC and abort all the queued transfers.
+ *******************************************************************************/
+int32_t axi_dmac_transfer_stop(struct axi_dmac *dmac)
+{
+	uint32_t i;
+
+	axi_dmac_lock(dmac);
+
+	axi_dmac_write(dmac, AXI_DMAC_REG_CTRL, 0x0);
+
+	for (i = 0; i < AXI_DMAC_MAX_TRANSFERS; i++) {
+		if (!(dmac->queued & BIT(i)))
+			continue;
+		dmac->queued &= ~BIT(i);
+		dmac->xfers[i].state = AXI_DMAC_XFER_ABORTED;
+	}
+
+	axi_dmac_unlock(dmac);
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_transfer
+ *******************************************************************************/
+int32_t axi_dmac_transfer(struct axi_dmac *dmac,
+			  uint32_t address, uint32_t size)
+{
+	struct axi_dmac_xfer *xfer;
+	int32_t ret;
+
+	/* A new blocking transfer restarts the DMAC. */
+	if (dmac->queued)
+		axi_dmac_transfer_stop(dmac);
+
+	ret = axi_dmac_transfer_submit(dmac, address, size, NULL, NULL, &xfer);
+	if (ret != SUCCESS)
+		return ret;
+
 	if (dmac->flags & DMA_CYCLIC)
 		return SUCCESS;
 
-	/* Wait until the new transfer is queued. */
-	do {
-		axi_dmac_read(dmac, AXI_DMAC_REG_START_TRANSFER, &reg_val);
-	} while(reg_val == 1);
+	return axi_dmac_transfer_wait(dmac, xfer, AXI_DMAC_TIMEOUT_INFINITE);
+}
 
-	/* Wait until the current transfer is completed. */
-	do {
-		axi_dmac_read(dmac, AXI_DMAC_REG_IRQ_PENDING, &reg_val);
-	} while(reg_val != (AXI_DMAC_IRQ_SOT | AXI_DMAC_IRQ_EOT));
-	axi_dmac_write(dmac, AXI_DMAC_REG_IRQ_PENDING, reg_val);
+/***************************************************************************//**
+ * @brief axi_dmac_transfer_2d
+ * Blocking 2D transfer, see axi_dmac_transfer().
+ *******************************************************************************/
+int32_t axi_dmac_transfer_2d(struct axi_dmac *dmac,
+			     const struct axi_dmac_xfer_2d *desc)
+{
+	struct axi_dmac_xfer *xfer;
+	int32_t ret;
 
-	/* Wait until the transfer with the ID transfer_id is completed. */
-	do {
-		axi_dmac_read(dmac, AXI_DMAC_REG_TRANSFER_DONE, &reg_val);
-	} while((reg_val & (1u << transfer_id)) != (1u << transfer_id));
+	if (dmac->queued)
+		axi_dmac_transfer_stop(dmac);
+
+	ret = axi_dmac_transfer_submit_2d(dmac, desc, NULL, NULL, &xfer);
+	if (ret != SUCCESS)
+		return ret;
+
+	if (dmac->flags & DMA_CYCLIC)
+		return SUCCESS;
+
+	return axi_dmac_transfer_wait(dmac, xfer, AXI_DMAC_TIMEOUT_INFINITE);
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_stream_oldest
+ * Find the oldest buffer in the given state.
+ *******************************************************************************/
+static struct axi_dmac_stream_buf *axi_dmac_stream_oldest(
+	struct axi_dmac_stream *stream, enum axi_dmac_stream_buf_state state)
+{
+	struct axi_dmac_stream_buf *oldest = NULL;
+	uint32_t i;
+
+	for (i = 0; i < stream->num_buffers; i++) {
+		if (stream->bufs[i].state != state)
+			continue;
+		if (!oldest || ((int32_t)(stream->bufs[i].seq - oldest->seq) < 0))
+			oldest = &stream->bufs[i];
+	}
+
+	return oldest;
+}
+
+static void axi_dmac_stream_complete(struct axi_dmac *dmac,
+				     struct axi_dmac_xfer *xfer, void *ctx);
+
+/***************************************************************************//**
+ * @brief axi_dmac_stream_queue
+ * Keep the hardware queue supplied with free buffers. When the consumer
+ * falls behind, the oldest filled buffer is recycled so that at least two
+ * transfers stay queued and the capture remains gap-free.
+ *******************************************************************************/
+static void axi_dmac_stream_queue(struct axi_dmac_stream *stream)
+{
+	struct axi_dmac *dmac = stream->dmac;
+	struct axi_dmac_stream_buf *buf;
+	struct axi_dmac_xfer *xfer;
+	bool overrun;
+
+	while (stream->running &&
+	       (hweight8(dmac->queued) < AXI_DMAC_MAX_TRANSFERS)) {
+		overrun = false;
+		buf = axi_dmac_stream_oldest(stream, AXI_DMAC_STREAM_BUF_FREE);
+		if (!buf && (hweight8(dmac->queued) < 2)) {
+			buf = axi_dmac_stream_oldest(stream,
+						     AXI_DMAC_STREAM_BUF_FILLED);
+			overrun = true;
+		}
+		if (!buf)
+			break;
+
+		if (axi_dmac_transfer_submit(dmac, buf->address, buf->size,
+					     axi_dmac_stream_complete, stream,
+					     &xfer) != SUCCESS)
+			break;
+
+		buf->state = AXI_DMAC_STREAM_BUF_QUEUED;
+		stream->xfer_buf[xfer->id] = buf - stream->bufs;
+		if (overrun)
+			stream->overruns++;
+	}
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_stream_complete
+ *******************************************************************************/
+static void axi_dmac_stream_complete(struct axi_dmac *dmac,
+				     struct axi_dmac_xfer *xfer, void *ctx)
+{
+	struct axi_dmac_stream *stream = ctx;
+	struct axi_dmac_stream_buf *buf;
+
+	buf = &stream->bufs[stream->xfer_buf[xfer->id]];
+	buf->seq = stream->seq++;
+	buf->gap = stream->gap;
+	buf->state = AXI_DMAC_STREAM_BUF_FILLED;
+
+	/* The DMAC went idle after this transfer, samples are lost. */
+	stream->gap = xfer->idle;
+	if (stream->gap)
+		stream->underruns++;
+
+	/* Report the buffer before it can be recycled by an overrun. */
+	if (stream->filled)
+		stream->filled(stream, buf, stream->ctx);
+
+	axi_dmac_stream_queue(stream);
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_stream_init
+ *******************************************************************************/
+int32_t axi_dmac_stream_init(struct axi_dmac_stream **stream,
+			     struct axi_dmac *dmac,
+			     const struct axi_dmac_stream_init *init)
+{
+	struct axi_dmac_stream *s;
+	uint32_t i;
+
+	if ((init->num_buffers < 2) ||
+	    (init->num_buffers > AXI_DMAC_STREAM_MAX_BUFFERS) ||
+	    (dmac->direction != DMA_DEV_TO_MEM))
+		return FAILURE;
+
+	s = (struct axi_dmac_stream *)calloc(1, sizeof(*s));
+	if (!s)
+		return FAILURE;
+
+	s->dmac = dmac;
+	s->filled = init->filled;
+	s->ctx = init->ctx;
+	s->num_buffers = init->num_buffers;
+	for (i = 0; i < s->num_buffers; i++) {
+		s->bufs[i].address = init->address + i * init->size;
+		s->bufs[i].size = init->size;
+	}
+
+	*stream = s;
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_stream_remove
+ *******************************************************************************/
+int32_t axi_dmac_stream_remove(struct axi_dmac_stream *stream)
+{
+	if (!stream)
+		return FAILURE;
+
+	axi_dmac_stream_stop(stream);
+	free(stream);
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_stream_start
+ * Start streaming. The DMAC flags are cleared while streaming and restored by
+ * axi_dmac_stream_stop().
+ *******************************************************************************/
+int32_t axi_dmac_stream_start(struct axi_dmac_stream *stream)
+{
+	struct axi_dmac *dmac = stream->dmac;
+	uint32_t i;
+
+	if (stream->running)
+		return SUCCESS;
+
+	if (dmac->queued)
+		axi_dmac_transfer_stop(dmac);
+
+	for (i = 0; i < stream->num_buffers; i++)
+		stream->bufs[i].state = AXI_DMAC_STREAM_BUF_FREE;
+	stream->seq = 0;
+	stream->overruns = 0;
+	stream->underruns = 0;
+	stream->gap = false;
+
+	/* The ring is made of single shot transfers */
+	stream->dmac_flags = dmac->flags;
+	dmac->flags = 0;
+	stream->running = true;
+
+	axi_dmac_lock(dmac);
+	axi_dmac_stream_queue(stream);
+	axi_dmac_unlock(dmac);
+
+	if (!dmac->queued) {
+		stream->running = false;
+		dmac->flags = stream->dmac_flags;
+		return FAILURE;
+	}
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_stream_stop
+ *******************************************************************************/
+int32_t axi_dmac_stream_stop(struct axi_dmac_stream *stream)
+{
+	uint32_t i;
+
+	if (!stream->running)
+		return SUCCESS;
+
+	stream->running = false;
+	axi_dmac_transfer_stop(stream->dmac);
+	stream->dmac->flags = stream->dmac_flags;
+
+	for (i = 0; i < stream->num_buffers; i++)
+		if (stream->bufs[i].state == AXI_DMAC_STREAM_BUF_QUEUED)
+			stream->bufs[i].state = AXI_DMAC_STREAM_BUF_FREE;
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_stream_filled_cond
+ * poll_timeout() condition of axi_dmac_stream_get(), takes the oldest filled
+ * buffer and fails once the stream is stopped.
+ *******************************************************************************/
+static int32_t axi_dmac_stream_filled_cond(void *ctx)
+{
+	struct axi_dmac_poll *poll = ctx;
+	struct axi_dmac *dmac = poll->dmac;
+	struct axi_dmac_stream_buf *b;
+
+	axi_dmac_lock(dmac);
+	if (!dmac->irq_en)
+		axi_dmac_complete(dmac);
+	b = axi_dmac_stream_oldest(poll->stream, AXI_DMAC_STREAM_BUF_FILLED);
+	if (b)
+		b->state = AXI_DMAC_STREAM_BUF_HELD;
+	axi_dmac_unlock(dmac);
+
+	if (b) {
+		poll->buf = b;
+		return 1;
+	}
+
+	return poll->stream->running ? 0 : FAILURE;
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_stream_get
+ * Get the oldest filled buffer. The buffer belongs to the caller until it is
+ * handed back with axi_dmac_stream_release().
+ *******************************************************************************/
+int32_t axi_dmac_stream_get(struct axi_dmac_stream *stream,
+			    struct axi_dmac_stream_buf **buf,
+			    uint32_t timeout_ms)
+{
+	struct axi_dmac_poll poll = {
+		.dmac = stream->dmac,
+		.stream = stream,
+		.buf = NULL
+	};
+
+	if (axi_dmac_poll(axi_dmac_stream_filled_cond, &poll,
+			  timeout_ms) != SUCCESS)
+		return FAILURE;
+
+	*buf = poll.buf;
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief axi_dmac_stream_release
+ *******************************************************************************/
+int32_t axi_dmac_stream_release(struct axi_dmac_stream *stream,
+				struct axi_dmac_stream_buf *buf)
+{
+	if (buf->state != AXI_DMAC_STREAM_BUF_HELD)
+		return FAILURE;
+
+	axi_dmac_lock(stream->dmac);
+	buf->state = AXI_DMAC_STREAM_BUF_FREE;
+	axi_dmac_stream_queue(stream);
+	axi_dmac_unlock(stream->dmac);
 
 	return SUCCESS;
 }
@@ -137,8 +696,9 @@ int32_t axi_dmac_init(struct axi_dmac **dmac_core,
 		      const struct axi_dmac_init *init)
 {
 	struct axi_dmac *dmac;
+	uint32_t reg_val;
 
-	dmac = (struct axi_dmac *)malloc(sizeof(*dmac));
+	dmac = (struct axi_dmac *)calloc(1, sizeof(*dmac));
 	if (!dmac)
 		return FAILURE;
 
@@ -146,6 +706,13 @@ int32_t axi_dmac_init(struct axi_dmac **dmac_core,
 	dmac->base = init->base;
 	dmac->direction = init->direction;
 	dmac->flags = init->flags;
+	dmac->irq_en = init->irq_en;
+
+	/* Y_LENGTH is only writable on cores with 2D transfer support. */
+	axi_dmac_write(dmac, AXI_DMAC_REG_Y_LENGTH, 0xFFFFFFFF);
+	axi_dmac_read(dmac, AXI_DMAC_REG_Y_LENGTH, &reg_val);
+	dmac->hw_2d = (reg_val != 0);
+	axi_dmac_write(dmac, AXI_DMAC_REG_Y_LENGTH, 0x0);
 
 	*dmac_core = dmac;
 
@@ -68,6 +68,15 @@
 #define AXI_DMAC_REG_SRC_STRIDE		0x424
 #define AXI_DMAC_REG_TRANSFER_DONE	0x428
 
+/* Depth of the hardware transfer queue (2-bit transfer IDs). */
+#define AXI_DMAC_MAX_TRANSFERS		4
+
+/* Maximum number of buffers of a streaming ring. */
+#define AXI_DMAC_STREAM_MAX_BUFFERS	16
+
+/* Wait forever in axi_dmac_transfer_wait(). */
+#define AXI_DMAC_TIMEOUT_INFINITE	0xFFFFFFFF
+
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
@@ -81,11 +90,74 @@ enum dma_flags {
 	DMA_LAST = 2
 };
 
+enum axi_dmac_xfer_state {
+	AXI_DMAC_XFER_FREE,
+	AXI_DMAC_XFER_QUEUED,
+	AXI_DMAC_XFER_DONE,
+	AXI_DMAC_XFER_ABORTED
+};
+
+struct axi_dmac;
+
+/**
+ * @struct axi_dmac_xfer
+ * @brief Handle of a transfer submitted to the DMAC hardware queue. The
+ * handle is owned by the DMAC and is reused once its hardware transfer ID is
+ * assigned to a new transfer.
+ */
+struct axi_dmac_xfer {
+	/** Hardware transfer ID */
+	uint32_t id;
+	/** Memory address */
+	uint32_t address;
+	/** Transfer size in bytes */
+	uint32_t size;
+	/** Transfer state, updated from the completion path */
+	volatile enum axi_dmac_xfer_state state;
+	/** No other transfer was pending in the hardware when this one was
+	 *  retired, the DMAC went idle after it */
+	bool idle;
+	/** Completion callback, called from the IRQ handler in IRQ mode */
+	void (*complete)(struct axi_dmac *dmac, struct axi_dmac_xfer *xfer,
+			 void *ctx);
+	/** Completion callback context */
+	void *ctx;
+};
+
+/**
+ * @struct axi_dmac_xfer_2d
+ * @brief 2D transfer: y_length rows of x_length bytes. On the memory side,
+ * consecutive rows start stride bytes apart, on the device side the rows are
+ * contiguous.
+ */
+struct axi_dmac_xfer_2d {
+	/** Memory address of the first row */
+	uint32_t address;
+	/** Row length in bytes */
+	uint32_t x_length;
+	/** Number of rows */
+	uint32_t y_length;
+	/** Distance in bytes between the start of consecutive rows */
+	uint32_t stride;
+};
+
 struct axi_dmac {
 	const char *name;
 	uint32_t base;
 	enum dma_direction direction;
 	uint32_t flags;
+	/** Completion is signalled by axi_dmac_irq_handler() */
+	bool irq_en;
+	/** The core supports 2D transfers */
+	bool hw_2d;
+	/** Transfers indexed by hardware transfer ID */
+	struct axi_dmac_xfer xfers[AXI_DMAC_MAX_TRANSFERS];
+	/** Mask of the queued transfer IDs */
+	volatile uint32_t queued;
+	/** ID of the oldest queued transfer */
+	uint32_t next_done;
+	/** Nesting depth of the sections run with the DMAC interrupt masked */
+	uint32_t lock;
 };
 
 struct axi_dmac_init {
@@ -93,6 +165,89 @@ struct axi_dmac_init {
 	uint32_t base;
 	enum dma_direction direction;
 	uint32_t flags;
+	/** Set if axi_dmac_irq_handler() is registered for the DMAC interrupt */
+	bool irq_en;
+};
+
+enum axi_dmac_stream_buf_state {
+	/** Owned by the stream, ready to be queued */
+	AXI_DMAC_STREAM_BUF_FREE,
+	/** Queued to the DMAC */
+	AXI_DMAC_STREAM_BUF_QUEUED,
+	/** Filled, waiting for the consumer */
+	AXI_DMAC_STREAM_BUF_FILLED,
+	/** Handed to the consumer by axi_dmac_stream_get() */
+	AXI_DMAC_STREAM_BUF_HELD
+};
+
+/**
+ * @struct axi_dmac_stream_buf
+ * @brief Buffer of a streaming ring.
+ */
+struct axi_dmac_stream_buf {
+	/** Buffer address */
+	uint32_t address;
+	/** Buffer size in bytes */
+	uint32_t size;
+	/** Fill sequence number. Data of buffers with consecutive sequence
+	 *  numbers is contiguous, unless gap is set on the later one. */
+	uint32_t seq;
+	/** Samples were lost by the hardware before this buffer */
+	bool gap;
+	/** Buffer state */
+	volatile enum axi_dmac_stream_buf_state state;
+};
+
+/**
+ * @struct axi_dmac_stream
+ * @brief Continuous, gap-free capture into a ring of buffers.
+ */
+struct axi_dmac_stream {
+	/** DMAC instance */
+	struct axi_dmac *dmac;
+	/** Called for each filled buffer, from the completion path */
+	void (*filled)(struct axi_dmac_stream *stream,
+		       struct axi_dmac_stream_buf *buf, void *ctx);
+	/** Context of "filled" */
+	void *ctx;
+	/** Number of buffers */
+	uint32_t num_buffers;
+	/** Buffers */
+	struct axi_dmac_stream_buf bufs[AXI_DMAC_STREAM_MAX_BUFFERS];
+	/** Buffer index for each hardware transfer ID */
+	uint32_t xfer_buf[AXI_DMAC_MAX_TRANSFERS];
+	/** Sequence number of the next filled buffer */
+	uint32_t seq;
+	/** Filled buffers dropped because the consumer fell behind */
+	uint32_t overruns;
+	/** Times the hardware queue ran empty and samples were lost */
+	uint32_t underruns;
+	/** The next filled buffer follows lost samples */
+	bool gap;
+	/** Streaming is active */
+	volatile bool running;
+	/** DMAC flags to restore when streaming stops */
+	uint32_t dmac_flags;
+};
+
+/**
+ * @struct axi_dmac_stream_init
+ * @brief Streaming ring parameters. The buffers are laid out back to back
+ * starting at address.
+ */
+struct axi_dmac_stream_init {
+	/** Address of the first buffer */
+	uint32_t address;
+	/** Size of a buffer in bytes */
+	uint32_t size;
+	/** Number of buffers, at least 2 */
+	uint32_t num_buffers;
+	/** Optional, called for each filled buffer, from the completion path
+	 *  (the IRQ handler in IRQ mode), before the buffer can be recycled */
+	void (*filled)(struct axi_dmac_stream *stream,
+		       struct axi_dmac_stream_buf *buf, void *ctx);
+	/** Context of "filled" */
+	void *ctx;
 };
 
 /******************************************************************************/
@@ -104,6 +259,40 @@ int32_t axi_dmac_write(struct axi_dmac *dmac, uint32_t reg_addr,
 		       uint32_t reg_data);
 int32_t axi_dmac_transfer(struct axi_dmac *dmac,
 			  uint32_t address, uint32_t size);
+int32_t axi_dmac_transfer_submit(struct axi_dmac *dmac,
+				 uint32_t address, uint32_t size,
+				 void (*complete)(struct axi_dmac *dmac,
+						 struct axi_dmac_xfer *xfer,
+						 void *ctx),
+				 void *ctx,
+				 struct axi_dmac_xfer **xfer);
+int32_t axi_dmac_transfer_submit_2d(struct axi_dmac *dmac,
+				    const struct axi_dmac_xfer_2d *desc,
+				    void (*complete)(struct axi_dmac *dmac,
+						    struct axi_dmac_xfer *xfer,
+						    void *ctx),
+				    void *ctx,
+				    struct axi_dmac_xfer **xfer);
+int32_t axi_dmac_transfer_2d(struct axi_dmac *dmac,
+			     const struct axi_dmac_xfer_2d *desc);
+int32_t axi_dmac_transfer_wait(struct axi_dmac *dmac,
+			       struct axi_dmac_xfer *xfer,
+			       uint32_t timeout_ms);
+bool axi_dmac_transfer_done(struct axi_dmac *dmac,
+			    struct axi_dmac_xfer *xfer);
+int32_t axi_dmac_transfer_stop(struct axi_dmac *dmac);
+void axi_dmac_irq_handler(void *data);
+int32_t axi_dmac_stream_init(struct axi_dmac_stream **stream,
+			     struct axi_dmac *dmac,
+			     const struct axi_dmac_stream_init *init);
+int32_t axi_dmac_stream_remove(struct axi_dmac_stream *stream);
+int32_t axi_dmac_stream_start(struct axi_dmac_stream *stream);
+int32_t axi_dmac_stream_stop(struct axi_dmac_stream *stream);
+int32_t axi_dmac_stream_get(struct axi_dmac_stream *stream,
+			    struct axi_dmac_stream_buf **buf,
+			    uint32_t timeout_ms);
+int32_t axi_dmac_stream_release(struct axi_dmac_stream *stream,
+				struct axi_dmac_stream_buf *buf);
 int32_t axi_dmac_init(struct axi_dmac **adc_core,
 		      const struct axi_dmac_init *init);
 int32_t axi_dmac_remove(struct axi_dmac *dmac);
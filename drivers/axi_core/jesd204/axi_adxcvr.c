@@ -47,6 +47,7 @@
 #include "util.h"
 #include "error.h"
 #include "delay.h"
+#include "poll_timeout.h"
 #include "xilinx_transceiver.h"
 #include "axi_adxcvr.h"
 
@@ -86,6 +87,18 @@
 
 #define ADXCVR_BROADCAST				0xff
 
+#define ADXCVR_DRP_TIMEOUT_US			20000
+
+/**
+ * @struct adxcvr_drp_poll
+ * @brief DRP status poll condition, see adxcvr_drp_wait_idle().
+ */
+struct adxcvr_drp_poll {
+	struct adxcvr *xcvr;
+	uint32_t drp_addr;
+	uint32_t status;
+};
+
 /**
  * @brief adxcvr_write
  */
@@ -110,26 +123,36 @@ int32_t adxcvr_read(struct adxcvr *xcvr,
 	return SUCCESS;
 }
 
+/**
+ * @brief adxcvr_drp_idle
+ */
+static int32_t adxcvr_drp_idle(void *ctx)
+{
+	struct adxcvr_drp_poll *poll = ctx;
+
+	adxcvr_read(poll->xcvr, ADXCVR_REG_DRP_STATUS(poll->drp_addr),
+		    &poll->status);
+
+	return !(poll->status & ADXCVR_DRP_STATUS_BUSY);
+}
+
 /**
  * @brief adxcvr_drp_wait_idle
  */
 int32_t adxcvr_drp_wait_idle(struct adxcvr *xcvr,
 			     uint32_t drp_addr)
 {
-	uint32_t val;
-	int32_t timeout = 20;
-
-	do {
-		adxcvr_read(xcvr, ADXCVR_REG_DRP_STATUS(drp_addr), &val);
-		if (!(val & ADXCVR_DRP_STATUS_BUSY))
-			return ADXCVR_DRP_STATUS_RDATA(val);
+	struct adxcvr_drp_poll poll = {
+		.xcvr = xcvr,
+		.drp_addr = drp_addr,
+	};
 
-		mdelay(1);
-	} while (timeout--);
-
-	printf("%s: %s: Timeout!", xcvr->name, __func__);
+	if (poll_timeout(adxcvr_drp_idle, &poll, ADXCVR_DRP_TIMEOUT_US) < 0) {
+		printf("%s: %s: Timeout!", xcvr->name, __func__);
+		return FAILURE;
+	}
 
-	return FAILURE;
+	return ADXCVR_DRP_STATUS_RDATA(poll.status);
 }
 
 /**
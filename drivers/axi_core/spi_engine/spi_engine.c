@@ -0,0 +1,634 @@
+/***************************************************************************//**
+ *   @file   spi_engine.c
+ *   @brief  Driver for the Analog Devices SPI Engine core.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "axi_io.h"
+#include "error.h"
+#include "spi_engine.h"
+
+/***************************************************************************//**
+ * @brief spi_engine_read
+ *******************************************************************************/
+int32_t spi_engine_read(struct spi_engine_desc *desc,
+			uint32_t reg_addr,
+			uint32_t *reg_data)
+{
+	axi_io_read(desc->base, reg_addr, reg_data);
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_write
+ *******************************************************************************/
+int32_t spi_engine_write(struct spi_engine_desc *desc,
+			 uint32_t reg_addr,
+			 uint32_t reg_data)
+{
+	axi_io_write(desc->base, reg_addr, reg_data);
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_program_add_cmd
+ * The last command slot is kept for the SYNC added by
+ * spi_engine_program_end().
+ *******************************************************************************/
+static void spi_engine_program_add_cmd(struct spi_engine_program *prog,
+				       uint16_t cmd)
+{
+	if (prog->cmd_len >= SPI_ENGINE_MAX_CMDS - 1) {
+		prog->overflow = true;
+		return;
+	}
+
+	prog->cmds[prog->cmd_len++] = cmd;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_program_init
+ *******************************************************************************/
+void spi_engine_program_init(struct spi_engine_desc *desc,
+			     struct spi_engine_program *prog)
+{
+	prog->cmd_len = 0;
+	prog->sdo_len = 0;
+	prog->sdi_len = 0;
+	prog->overflow = false;
+	prog->version++;
+
+	spi_engine_program_add_cmd(prog,
+				   SPI_ENGINE_CMD_WRITE(SPI_ENGINE_CMD_REG_CLK_DIV,
+						   desc->clk_div));
+	spi_engine_program_add_cmd(prog,
+				   SPI_ENGINE_CMD_WRITE(SPI_ENGINE_CMD_REG_CONFIG,
+						   desc->config));
+	spi_engine_program_add_cmd(prog,
+				   SPI_ENGINE_CMD_WRITE(SPI_ENGINE_CMD_DATA_TRANSFER_LEN,
+						   desc->data_width));
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_program_cs
+ *******************************************************************************/
+void spi_engine_program_cs(struct spi_engine_desc *desc,
+			   struct spi_engine_program *prog, bool assert)
+{
+	uint8_t mask = 0xff;
+
+	if (assert)
+		mask ^= BIT(desc->chip_select);
+
+	spi_engine_program_add_cmd(prog, SPI_ENGINE_CMD_ASSERT(desc->cs_delay,
+				   mask));
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_program_add_transfer
+ * A transfer command moves at most 256 words, longer transfers are split.
+ *******************************************************************************/
+static void spi_engine_program_add_transfer(struct spi_engine_program *prog,
+		bool write, bool read,
+		uint32_t words_number)
+{
+	uint32_t n;
+
+	while (words_number) {
+		n = min(words_number, (uint32_t)256);
+		spi_engine_program_add_cmd(prog,
+					   SPI_ENGINE_CMD_TRANSFER(write ? 1 : 0,
+							   read ? 1 : 0, n - 1));
+		words_number -= n;
+	}
+	prog->version++;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_program_transfer
+ *******************************************************************************/
+void spi_engine_program_transfer(struct spi_engine_program *prog,
+				 const uint32_t *tx, bool read,
+				 uint32_t words_number)
+{
+	if (tx) {
+		if (prog->sdo_len + words_number > SPI_ENGINE_MAX_SDO) {
+			prog->overflow = true;
+			return;
+		}
+		memcpy(&prog->sdo[prog->sdo_len], tx,
+		       words_number * sizeof(*prog->sdo));
+		prog->sdo_len += words_number;
+	}
+	if (read)
+		prog->sdi_len += words_number;
+
+	spi_engine_program_add_transfer(prog, tx != NULL, read, words_number);
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_program_stream_write
+ * The SDO words are not part of the program, an offload running it takes
+ * them from its SDO stream, fed by a DMA or by the device core.
+ *******************************************************************************/
+void spi_engine_program_stream_write(struct spi_engine_program *prog,
+				     uint32_t words_number)
+{
+	spi_engine_program_add_transfer(prog, true, false, words_number);
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_program_sleep
+ *******************************************************************************/
+void spi_engine_program_sleep(struct spi_engine_desc *desc,
+			      struct spi_engine_program *prog,
+			      uint32_t sleep_ns)
+{
+	uint32_t div;
+
+	div = (desc->ref_clk_hz / 1000000 * sleep_ns / 1000) /
+	      ((desc->clk_div + 1) * 2);
+	div = div ? div - 1 : 0;
+	if (div > 0xff)
+		div = 0xff;
+
+	spi_engine_program_add_cmd(prog, SPI_ENGINE_CMD_SLEEP(div));
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_program_end
+ * The program ends with a SYNC, its ID is set when the program is run.
+ *******************************************************************************/
+int32_t spi_engine_program_end(struct spi_engine_program *prog)
+{
+	if (prog->overflow)
+		return FAILURE;
+
+	prog->cmds[prog->cmd_len++] = SPI_ENGINE_CMD_SYNC(0);
+	prog->version++;
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_write_fifo
+ * Write words to a FIFO of the core, as room becomes available.
+ *******************************************************************************/
+static int32_t spi_engine_write_fifo(struct spi_engine_desc *desc,
+				     uint32_t fifo_reg, uint32_t room_reg,
+				     const void *words, uint32_t word_size,
+				     uint32_t count)
+{
+	uint32_t timeout = SPI_ENGINE_SYNC_TIMEOUT;
+	uint32_t room = 0, i;
+
+	for (i = 0; i < count; i++) {
+		while (!room) {
+			if (!--timeout)
+				return FAILURE;
+			spi_engine_read(desc, room_reg, &room);
+		}
+		if (word_size == sizeof(uint16_t))
+			spi_engine_write(desc, fifo_reg,
+					 ((const uint16_t *)words)[i]);
+		else
+			spi_engine_write(desc, fifo_reg,
+					 ((const uint32_t *)words)[i]);
+		room--;
+	}
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_write_mem
+ * Write words to an offload memory of the core.
+ *******************************************************************************/
+static void spi_engine_write_mem(struct spi_engine_desc *desc,
+				 uint32_t mem_reg, const void *words,
+				 uint32_t word_size, uint32_t count)
+{
+	uint32_t i;
+
+	for (i = 0; i < count; i++) {
+		if (word_size == sizeof(uint16_t))
+			spi_engine_write(desc, mem_reg,
+					 ((const uint16_t *)words)[i]);
+		else
+			spi_engine_write(desc, mem_reg,
+					 ((const uint32_t *)words)[i]);
+	}
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_program_run
+ * The SDI FIFO is drained while the program runs, the program is done once
+ * its SYNC ID is reported and all its SDI words are read.
+ *******************************************************************************/
+int32_t spi_engine_program_run(struct spi_engine_desc *desc,
+			       struct spi_engine_program *prog,
+			       uint32_t *rx)
+{
+	uint32_t timeout = SPI_ENGINE_SYNC_TIMEOUT;
+	uint32_t level, sync, data, i = 0;
+	int32_t ret;
+
+	if (prog->overflow || !prog->cmd_len)
+		return FAILURE;
+
+	desc->sync_id++;
+	prog->cmds[prog->cmd_len - 1] = SPI_ENGINE_CMD_SYNC(desc->sync_id);
+
+	ret = spi_engine_write_fifo(desc, SPI_ENGINE_REG_CMD_FIFO,
+				    SPI_ENGINE_REG_CMD_FIFO_ROOM, prog->cmds,
+				    sizeof(*prog->cmds), prog->cmd_len);
+	if (ret < 0)
+		return ret;
+
+	ret = spi_engine_write_fifo(desc, SPI_ENGINE_REG_SDO_DATA_FIFO,
+				    SPI_ENGINE_REG_SDO_FIFO_ROOM, prog->sdo,
+				    sizeof(*prog->sdo), prog->sdo_len);
+	if (ret < 0)
+		return ret;
+
+	do {
+		spi_engine_read(desc, SPI_ENGINE_REG_SDI_FIFO_LEVEL, &level);
+		for (; level && (i < prog->sdi_len); level--, i++) {
+			spi_engine_read(desc, SPI_ENGINE_REG_SDI_DATA_FIFO, &data);
+			if (rx)
+				rx[i] = data;
+		}
+		spi_engine_read(desc, SPI_ENGINE_REG_SYNC_ID, &sync);
+		if (((sync & 0xff) == desc->sync_id) && (i == prog->sdi_len))
+			return SUCCESS;
+	} while (--timeout);
+
+	return FAILURE;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_set_transfer_width
+ * Programs built afterwards transfer words of "bits" bits.
+ *******************************************************************************/
+int32_t spi_engine_set_transfer_width(struct spi_engine_desc *desc,
+				      uint8_t bits)
+{
+	if (!bits || (bits > desc->max_data_width))
+		return FAILURE;
+
+	if (desc->data_width != bits) {
+		desc->data_width = bits;
+		desc->rw_bytes = 0;
+	}
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_set_speed
+ * Programs built afterwards run at the SPI clock derived from "hz",
+ * programs built before keep their clock.
+ *******************************************************************************/
+int32_t spi_engine_set_speed(struct spi_engine_desc *desc, uint32_t hz)
+{
+	uint32_t clk_div = 0;
+
+	if (!hz)
+		return FAILURE;
+
+	if (desc->ref_clk_hz > 2 * hz)
+		clk_div = desc->ref_clk_hz / (2 * hz) - 1;
+	if (clk_div > 0xff)
+		clk_div = 0xff;
+
+	if (desc->clk_div != clk_div) {
+		desc->clk_div = clk_div;
+		desc->rw_bytes = 0;
+	}
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_write_and_read
+ * The program is rebuilt only when the transfer length changes, otherwise
+ * only its SDO words are updated.
+ *******************************************************************************/
+int32_t spi_engine_write_and_read(struct spi_engine_desc *desc,
+				  uint8_t *data, uint32_t bytes_number)
+{
+	struct spi_engine_program *prog = &desc->rw_prog;
+	uint32_t words[SPI_ENGINE_MAX_SDO];
+	uint32_t bytes_per_word = desc->data_width / 8;
+	uint32_t words_number, i, shift;
+	int32_t ret;
+
+	if (desc->data_width % 8)
+		return FAILURE;
+
+	words_number = (bytes_number + bytes_per_word - 1) / bytes_per_word;
+	if (!words_number || (words_number > SPI_ENGINE_MAX_SDO))
+		return FAILURE;
+
+	memset(words, 0, words_number * sizeof(*words));
+	for (i = 0; i < bytes_number; i++) {
+		shift = 8 * (bytes_per_word - 1 - (i % bytes_per_word));
+		words[i / bytes_per_word] |= (uint32_t)data[i] << shift;
+	}
+
+	if (desc->rw_bytes != bytes_number) {
+		desc->rw_bytes = 0;
+		spi_engine_program_init(desc, prog);
+		spi_engine_program_cs(desc, prog, true);
+		spi_engine_program_transfer(prog, words, true, words_number);
+		spi_engine_program_cs(desc, prog, false);
+		ret = spi_engine_program_end(prog);
+		if (ret < 0)
+			return ret;
+		desc->rw_bytes = bytes_number;
+	} else {
+		memcpy(prog->sdo, words, words_number * sizeof(*words));
+		prog->version++;
+	}
+
+	ret = spi_engine_program_run(desc, prog, words);
+	if (ret < 0)
+		return ret;
+
+	for (i = 0; i < bytes_number; i++) {
+		shift = 8 * (bytes_per_word - 1 - (i % bytes_per_word));
+		data[i] = words[i / bytes_per_word] >> shift;
+	}
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_offload_load
+ * Loading is skipped if the slot already holds this version of the
+ * program, so switching between loaded programs costs no register writes.
+ *******************************************************************************/
+int32_t spi_engine_offload_load(struct spi_engine_desc *desc, uint32_t slot,
+				const struct spi_engine_program *prog)
+{
+	struct spi_engine_offload *offload;
+	bool enabled;
+
+	if ((slot >= SPI_ENGINE_MAX_OFFLOADS) || prog->overflow ||
+	    !prog->cmd_len)
+		return FAILURE;
+
+	offload = &desc->offload[slot];
+	if ((offload->prog == prog) && (offload->version == prog->version))
+		return SUCCESS;
+
+	enabled = offload->enabled;
+	if (enabled)
+		spi_engine_offload_enable(desc, slot, false);
+
+	offload->prog = NULL;
+	spi_engine_write(desc, SPI_ENGINE_REG_OFFLOAD_RESET(slot), 1);
+	spi_engine_write(desc, SPI_ENGINE_REG_OFFLOAD_RESET(slot), 0);
+
+	spi_engine_write_mem(desc, SPI_ENGINE_REG_OFFLOAD_CMD_MEM(slot),
+			     prog->cmds, sizeof(*prog->cmds), prog->cmd_len);
+	spi_engine_write_mem(desc, SPI_ENGINE_REG_OFFLOAD_SDO_MEM(slot),
+			     prog->sdo, sizeof(*prog->sdo), prog->sdo_len);
+
+	offload->prog = prog;
+	offload->version = prog->version;
+
+	if (enabled)
+		spi_engine_offload_enable(desc, slot, true);
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_offload_enable
+ *******************************************************************************/
+int32_t spi_engine_offload_enable(struct spi_engine_desc *desc, uint32_t slot,
+				  bool enable)
+{
+	if (slot >= SPI_ENGINE_MAX_OFFLOADS)
+		return FAILURE;
+	if (enable && !desc->offload[slot].prog)
+		return FAILURE;
+
+	spi_engine_write(desc, SPI_ENGINE_REG_OFFLOAD_CTRL(slot),
+			 enable ? SPI_ENGINE_OFFLOAD_CTRL_ENABLE : 0);
+	desc->offload[slot].enabled = enable;
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_offload_select
+ *******************************************************************************/
+int32_t spi_engine_offload_select(struct spi_engine_desc *desc, uint32_t slot)
+{
+	uint32_t i;
+
+	if ((slot >= SPI_ENGINE_MAX_OFFLOADS) || !desc->offload[slot].prog)
+		return FAILURE;
+
+	for (i = 0; i < SPI_ENGINE_MAX_OFFLOADS; i++)
+		if ((i != slot) && desc->offload[i].enabled)
+			spi_engine_offload_enable(desc, i, false);
+
+	return spi_engine_offload_enable(desc, slot, true);
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_stream_init
+ *******************************************************************************/
+int32_t spi_engine_stream_init(struct spi_engine_stream **stream,
+			       struct spi_engine_desc *desc,
+			       const struct spi_engine_stream_init *init)
+{
+	struct spi_engine_stream *s;
+	int32_t ret;
+
+	if ((init->slot >= SPI_ENGINE_MAX_OFFLOADS) || !init->prog ||
+	    !init->dmac)
+		return FAILURE;
+
+	s = (struct spi_engine_stream *)calloc(1, sizeof(*s));
+	if (!s)
+		return FAILURE;
+
+	ret = axi_dmac_stream_init(&s->ring, init->dmac, &init->ring);
+	if (ret < 0) {
+		free(s);
+		return ret;
+	}
+
+	s->desc = desc;
+	s->slot = init->slot;
+	s->prog = init->prog;
+
+	*stream = s;
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_stream_remove
+ *******************************************************************************/
+int32_t spi_engine_stream_remove(struct spi_engine_stream *stream)
+{
+	if (!stream)
+		return FAILURE;
+
+	spi_engine_stream_stop(stream);
+	axi_dmac_stream_remove(stream->ring);
+	free(stream);
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_stream_start
+ * The DMA ring is armed before the offload is enabled, so the first samples
+ * already have a buffer to go to.
+ *******************************************************************************/
+int32_t spi_engine_stream_start(struct spi_engine_stream *stream)
+{
+	int32_t ret;
+
+	ret = spi_engine_offload_load(stream->desc, stream->slot, stream->prog);
+	if (ret < 0)
+		return ret;
+
+	ret = axi_dmac_stream_start(stream->ring);
+	if (ret < 0)
+		return ret;
+
+	ret = spi_engine_offload_select(stream->desc, stream->slot);
+	if (ret < 0)
+		axi_dmac_stream_stop(stream->ring);
+
+	return ret;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_stream_stop
+ *******************************************************************************/
+int32_t spi_engine_stream_stop(struct spi_engine_stream *stream)
+{
+	spi_engine_offload_enable(stream->desc, stream->slot, false);
+
+	return axi_dmac_stream_stop(stream->ring);
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_stream_get
+ *******************************************************************************/
+int32_t spi_engine_stream_get(struct spi_engine_stream *stream,
+			      struct axi_dmac_stream_buf **buf,
+			      uint32_t timeout_ms)
+{
+	return axi_dmac_stream_get(stream->ring, buf, timeout_ms);
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_stream_release
+ *******************************************************************************/
+int32_t spi_engine_stream_release(struct spi_engine_stream *stream,
+				  struct axi_dmac_stream_buf *buf)
+{
+	return axi_dmac_stream_release(stream->ring, buf);
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_init
+ *******************************************************************************/
+int32_t spi_engine_init(struct spi_engine_desc **desc,
+			const struct spi_engine_init_param *param)
+{
+	struct spi_engine_desc *dev;
+	uint32_t data_width;
+
+	dev = (struct spi_engine_desc *)calloc(1, sizeof(*dev));
+	if (!dev)
+		return FAILURE;
+
+	dev->base = param->base;
+	dev->chip_select = param->chip_select;
+	dev->cs_delay = param->cs_delay;
+	dev->config = param->config;
+	dev->ref_clk_hz = param->ref_clk_hz;
+	if (param->spi_clk_hz)
+		spi_engine_set_speed(dev, param->spi_clk_hz);
+
+	spi_engine_write(dev, SPI_ENGINE_REG_RESET, 0x01);
+	spi_engine_write(dev, SPI_ENGINE_REG_RESET, 0x00);
+
+	/* Cores without configurable data width report 0, they use 8 bits. */
+	spi_engine_read(dev, SPI_ENGINE_REG_DATA_WIDTH, &data_width);
+	dev->max_data_width = (data_width >= 8 && data_width <= 32) ?
+			      data_width : 8;
+	dev->data_width = dev->max_data_width & ~0x7;
+
+	*desc = dev;
+
+	return SUCCESS;
+}
+
+/***************************************************************************//**
+ * @brief spi_engine_remove
+ *******************************************************************************/
+int32_t spi_engine_remove(struct spi_engine_desc *desc)
+{
+	uint32_t i;
+
+	if (!desc)
+		return FAILURE;
+
+	for (i = 0; i < SPI_ENGINE_MAX_OFFLOADS; i++)
+		if (desc->offload[i].enabled)
+			spi_engine_offload_enable(desc, i, false);
+
+	free(desc);
+
+	return SUCCESS;
+}
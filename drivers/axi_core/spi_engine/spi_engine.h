@@ -0,0 +1,306 @@
+/***************************************************************************//**
+ *   @file   spi_engine.h
+ *   @brief  Header file of the SPI Engine core driver.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef SPI_ENGINE_H_
+#define SPI_ENGINE_H_
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+#include "util.h"
+#include "axi_dmac.h"
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+#define SPI_ENGINE_REG_VERSION			0x00
+#define SPI_ENGINE_REG_DATA_WIDTH		0x0C
+#define SPI_ENGINE_REG_RESET			0x40
+#define SPI_ENGINE_REG_INT_ENABLE		0x80
+#define SPI_ENGINE_REG_INT_PENDING		0x84
+#define SPI_ENGINE_REG_INT_SOURCE		0x88
+#define SPI_ENGINE_REG_SYNC_ID			0xC0
+#define SPI_ENGINE_REG_CMD_FIFO_ROOM		0xD0
+#define SPI_ENGINE_REG_SDO_FIFO_ROOM		0xD4
+#define SPI_ENGINE_REG_SDI_FIFO_LEVEL		0xD8
+#define SPI_ENGINE_REG_CMD_FIFO			0xE0
+#define SPI_ENGINE_REG_SDO_DATA_FIFO		0xE4
+#define SPI_ENGINE_REG_SDI_DATA_FIFO		0xE8
+#define SPI_ENGINE_REG_SDI_DATA_FIFO_PEEK	0xEC
+#define SPI_ENGINE_REG_OFFLOAD_CTRL(x)		(0x100 + (0x20 * (x)))
+#define SPI_ENGINE_REG_OFFLOAD_STATUS(x)	(0x104 + (0x20 * (x)))
+#define SPI_ENGINE_REG_OFFLOAD_RESET(x)		(0x108 + (0x20 * (x)))
+#define SPI_ENGINE_REG_OFFLOAD_CMD_MEM(x)	(0x110 + (0x20 * (x)))
+#define SPI_ENGINE_REG_OFFLOAD_SDO_MEM(x)	(0x114 + (0x20 * (x)))
+
+#define SPI_ENGINE_INT_CMD_ALMOST_EMPTY		BIT(0)
+#define SPI_ENGINE_INT_SDO_ALMOST_EMPTY		BIT(1)
+#define SPI_ENGINE_INT_SDI_ALMOST_FULL		BIT(2)
+#define SPI_ENGINE_INT_SYNC			BIT(3)
+
+#define SPI_ENGINE_OFFLOAD_CTRL_ENABLE		BIT(0)
+#define SPI_ENGINE_OFFLOAD_STATUS_ENABLED	BIT(0)
+
+#define SPI_ENGINE_CONFIG_CPHA			BIT(0)
+#define SPI_ENGINE_CONFIG_CPOL			BIT(1)
+#define SPI_ENGINE_CONFIG_3WIRE			BIT(2)
+
+#define SPI_ENGINE_INST_TRANSFER		0x0
+#define SPI_ENGINE_INST_ASSERT			0x1
+#define SPI_ENGINE_INST_WRITE			0x2
+#define SPI_ENGINE_INST_MISC			0x3
+
+#define SPI_ENGINE_CMD_REG_CLK_DIV		0x0
+#define SPI_ENGINE_CMD_REG_CONFIG		0x1
+#define SPI_ENGINE_CMD_DATA_TRANSFER_LEN	0x2
+
+#define SPI_ENGINE_MISC_SYNC			0x0
+#define SPI_ENGINE_MISC_SLEEP			0x1
+
+#define SPI_ENGINE_CMD(inst, arg1, arg2) \
+	(((inst) << 12) | ((arg1) << 8) | (arg2))
+#define SPI_ENGINE_CMD_TRANSFER(write, read, n) \
+	SPI_ENGINE_CMD(SPI_ENGINE_INST_TRANSFER, ((read) << 1 | (write)), (n))
+#define SPI_ENGINE_CMD_ASSERT(delay, cs) \
+	SPI_ENGINE_CMD(SPI_ENGINE_INST_ASSERT, (delay), (cs))
+#define SPI_ENGINE_CMD_WRITE(reg, val) \
+	SPI_ENGINE_CMD(SPI_ENGINE_INST_WRITE, (reg), (val))
+#define SPI_ENGINE_CMD_SLEEP(delay) \
+	SPI_ENGINE_CMD(SPI_ENGINE_INST_MISC, SPI_ENGINE_MISC_SLEEP, (delay))
+#define SPI_ENGINE_CMD_SYNC(id) \
+	SPI_ENGINE_CMD(SPI_ENGINE_INST_MISC, SPI_ENGINE_MISC_SYNC, (id))
+
+/* Maximum number of commands of a program. */
+#define SPI_ENGINE_MAX_CMDS			64
+
+/* Maximum number of SDO words of a program. */
+#define SPI_ENGINE_MAX_SDO			32
+
+/* Number of offload slots handled by the driver. */
+#define SPI_ENGINE_MAX_OFFLOADS			4
+
+/* Number of SYNC_ID polls before a program is considered stuck. */
+#define SPI_ENGINE_SYNC_TIMEOUT			1000000
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @struct spi_engine_program
+ * @brief Compiled SPI Engine program: the command stream and the SDO words
+ * it consumes. A program is built once and can then be run any number of
+ * times or loaded into an offload slot, without being compiled again.
+ */
+struct spi_engine_program {
+	/** Command stream, ends with a SYNC command */
+	uint16_t cmds[SPI_ENGINE_MAX_CMDS];
+	/** Number of commands */
+	uint32_t cmd_len;
+	/** SDO words */
+	uint32_t sdo[SPI_ENGINE_MAX_SDO];
+	/** Number of SDO words */
+	uint32_t sdo_len;
+	/** Number of SDI words produced by the program */
+	uint32_t sdi_len;
+	/** Incremented each time the program changes */
+	uint32_t version;
+	/** Commands could not be added, the program is invalid */
+	bool overflow;
+};
+
+/**
+ * @struct spi_engine_offload
+ * @brief Content of an offload slot.
+ */
+struct spi_engine_offload {
+	/** Program loaded into the slot, NULL if none */
+	const struct spi_engine_program *prog;
+	/** Version of the loaded program */
+	uint32_t version;
+	/** The slot is enabled */
+	bool enabled;
+};
+
+/**
+ * @struct spi_engine_desc
+ * @brief SPI Engine core descriptor.
+ */
+struct spi_engine_desc {
+	/** Core base address */
+	uint32_t base;
+	/** Chip select */
+	uint8_t chip_select;
+	/** Delay of the chip select assert commands, in clock cycles */
+	uint8_t cs_delay;
+	/** SPI_ENGINE_CONFIG_* flags */
+	uint8_t config;
+	/** Clock divider */
+	uint32_t clk_div;
+	/** Reference clock in Hz */
+	uint32_t ref_clk_hz;
+	/** Data width of the core, in bits */
+	uint8_t max_data_width;
+	/** Word size of the transfers, in bits */
+	uint8_t data_width;
+	/** ID of the last SYNC command issued */
+	uint8_t sync_id;
+	/** Program used by spi_engine_write_and_read() */
+	struct spi_engine_program rw_prog;
+	/** Number of bytes "rw_prog" was built for */
+	uint32_t rw_bytes;
+	/** Offload slots */
+	struct spi_engine_offload offload[SPI_ENGINE_MAX_OFFLOADS];
+};
+
+/**
+ * @struct spi_engine_init_param
+ * @brief SPI Engine core initialization parameters.
+ */
+struct spi_engine_init_param {
+	/** Core base address */
+	uint32_t base;
+	/** Chip select */
+	uint8_t chip_select;
+	/** Delay of the chip select assert commands, in clock cycles */
+	uint8_t cs_delay;
+	/** SPI_ENGINE_CONFIG_* flags */
+	uint8_t config;
+	/** Reference clock in Hz */
+	uint32_t ref_clk_hz;
+	/** SPI clock in Hz */
+	uint32_t spi_clk_hz;
+};
+
+/**
+ * @struct spi_engine_stream_init
+ * @brief Offload streaming parameters.
+ */
+struct spi_engine_stream_init {
+	/** Offload slot */
+	uint32_t slot;
+	/** Program run by the offload on each trigger */
+	const struct spi_engine_program *prog;
+	/** DMAC receiving the offload SDI data */
+	struct axi_dmac *dmac;
+	/** Ring of buffers the data is captured into */
+	struct axi_dmac_stream_init ring;
+};
+
+/**
+ * @struct spi_engine_stream
+ * @brief Continuous offload capture into a DMA ring of buffers.
+ */
+struct spi_engine_stream {
+	/** SPI Engine core */
+	struct spi_engine_desc *desc;
+	/** Offload slot */
+	uint32_t slot;
+	/** Program run by the offload */
+	const struct spi_engine_program *prog;
+	/** DMA ring */
+	struct axi_dmac_stream *ring;
+};
+
+/******************************************************************************/
+/************************ Functions Declarations ******************************/
+/******************************************************************************/
+int32_t spi_engine_read(struct spi_engine_desc *desc, uint32_t reg_addr,
+			uint32_t *reg_data);
+int32_t spi_engine_write(struct spi_engine_desc *desc, uint32_t reg_addr,
+			 uint32_t reg_data);
+/* Start a program: clock, SPI configuration and data width. */
+void spi_engine_program_init(struct spi_engine_desc *desc,
+			     struct spi_engine_program *prog);
+/* Assert or deassert the chip select. */
+void spi_engine_program_cs(struct spi_engine_desc *desc,
+			   struct spi_engine_program *prog, bool assert);
+/* Transfer words, tx may be NULL for read only transfers. */
+void spi_engine_program_transfer(struct spi_engine_program *prog,
+				 const uint32_t *tx, bool read,
+				 uint32_t words_number);
+/* Write words taken from the offload SDO stream. Offload programs only. */
+void spi_engine_program_stream_write(struct spi_engine_program *prog,
+				     uint32_t words_number);
+/* Wait for the given time. */
+void spi_engine_program_sleep(struct spi_engine_desc *desc,
+			      struct spi_engine_program *prog,
+			      uint32_t sleep_ns);
+/* End a program. */
+int32_t spi_engine_program_end(struct spi_engine_program *prog);
+/* Run a program and wait for its end. */
+int32_t spi_engine_program_run(struct spi_engine_desc *desc,
+			       struct spi_engine_program *prog,
+			       uint32_t *rx);
+/* Set the word size of the programs built from now on. */
+int32_t spi_engine_set_transfer_width(struct spi_engine_desc *desc,
+				      uint8_t bits);
+/* Set the SPI clock of the programs built from now on. */
+int32_t spi_engine_set_speed(struct spi_engine_desc *desc, uint32_t hz);
+/* Write and read data, like a classic SPI controller. The transfer width
+ * must be a multiple of 8 bits. */
+int32_t spi_engine_write_and_read(struct spi_engine_desc *desc,
+				  uint8_t *data, uint32_t bytes_number);
+/* Load a program into an offload slot, unless it is already there. */
+int32_t spi_engine_offload_load(struct spi_engine_desc *desc, uint32_t slot,
+				const struct spi_engine_program *prog);
+/* Enable or disable an offload slot. */
+int32_t spi_engine_offload_enable(struct spi_engine_desc *desc, uint32_t slot,
+				  bool enable);
+/* Make "slot" the only enabled offload slot. */
+int32_t spi_engine_offload_select(struct spi_engine_desc *desc, uint32_t slot);
+int32_t spi_engine_stream_init(struct spi_engine_stream **stream,
+			       struct spi_engine_desc *desc,
+			       const struct spi_engine_stream_init *init);
+int32_t spi_engine_stream_remove(struct spi_engine_stream *stream);
+/* Start the capture, the data ends up in the ring without gaps. */
+int32_t spi_engine_stream_start(struct spi_engine_stream *stream);
+int32_t spi_engine_stream_stop(struct spi_engine_stream *stream);
+/* Get the oldest filled buffer, hand it back with ..._release(). */
+int32_t spi_engine_stream_get(struct spi_engine_stream *stream,
+			      struct axi_dmac_stream_buf **buf,
+			      uint32_t timeout_ms);
+int32_t spi_engine_stream_release(struct spi_engine_stream *stream,
+				  struct axi_dmac_stream_buf *buf);
+int32_t spi_engine_init(struct spi_engine_desc **desc,
+			const struct spi_engine_init_param *param);
+int32_t spi_engine_remove(struct spi_engine_desc *desc);
+
+#endif
@@ -43,8 +43,22 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "util.h"
+#include "poll_timeout.h"
 #include "ad9528.h"
 
+#define AD9528_POLL_TIMEOUT_US	100000
+
+/**
+ * @struct ad9528_poll_param
+ * @brief Register poll condition, see ad9528_poll().
+ */
+struct ad9528_poll_param {
+	struct ad9528_dev *dev;
+	uint32_t reg_addr;
+	uint32_t mask;
+	uint32_t data;
+};
+
 static bool ad9528_pll2_valid_calib_div(unsigned int div)
 {
 	if (div < 16 || div > 255)
@@ -189,6 +203,29 @@ int32_t ad9528_spi_write_n(struct ad9528_dev *dev,
 	return ret;
 }
 
+/***************************************************************************//**
+ * @brief Register poll condition, see ad9528_poll().
+ *
+ * @param ctx - The poll parameters.
+ *
+ * @return Returns 1 when the expected data was read, 0 otherwise or negative
+ *         error code.
+*******************************************************************************/
+static int32_t ad9528_poll_cond(void *ctx)
+{
+	struct ad9528_poll_param *poll = ctx;
+	uint32_t reg_data;
+	int32_t ret;
+
+	ret = ad9528_spi_read_n(poll->dev,
+				poll->reg_addr,
+				&reg_data);
+	if (ret < 0)
+		return ret;
+
+	return ((reg_data & poll->mask) == poll->data);
+}
+
 /***************************************************************************//**
  * @brief Poll register.
  *
@@ -204,22 +241,14 @@ int32_t ad9528_poll(struct ad9528_dev *dev,
 		    uint32_t mask,
 		    uint32_t data)
 {
-	uint32_t reg_data;
-	uint8_t timeout = 100;
-	int32_t ret;
-
-	do {
-		ret = ad9528_spi_read_n(dev,
-					reg_addr,
-					&reg_data);
-		if (ret < 0)
-			return ret;
-		mdelay(1);
-	} while (((reg_data & mask) != data) && --timeout);
-
-	return timeout ? 0 : -1;
-
-	return 0;
+	struct ad9528_poll_param poll = {
+		.dev = dev,
+		.reg_addr = reg_addr,
+		.mask = mask,
+		.data = data,
+	};
+
+	return poll_timeout(ad9528_poll_cond, &poll, AD9528_POLL_TIMEOUT_US);
 }
 
 /***************************************************************************//**
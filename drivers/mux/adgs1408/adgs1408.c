@@ -45,6 +45,7 @@
 #include <stdbool.h>
 #include "adgs1408.h"
 #include "error.h"
+#include "crc8.h"
 
 /******************************************************************************/
 /************************** Functions Implementation **************************/
@@ -58,23 +59,7 @@
 uint8_t adgs1408_compute_crc8(uint8_t *data,
 			      uint8_t data_size)
 {
-	uint8_t i;
-	uint8_t crc = 0;
-
-	while (data_size) {
-		for (i = 0x80; i != 0; i >>= 1) {
-			if (((crc & 0x80) != 0) != ((*data & i) != 0)) {
-				crc <<= 1;
-				crc ^= ADGS1408_CRC8_POLY;
-			} else {
-				crc <<= 1;
-			}
-		}
-		data++;
-		data_size--;
-	}
-
-	return crc;
+	return crc8(crc8_atm_table, data, data_size, 0);
 }
 
 /**
@@ -44,6 +44,7 @@
 #include "spi.h"
 #include "error.h"
 #include <stdlib.h>
+#include <string.h>
 
 /******************************************************************************/
 /*****************************  Variables   **********************************/
@@ -82,6 +83,14 @@ static struct spi_desc *alloc_data_mem(void)
 		return NULL;
 	}
 
+	adicup_desc->msg_buff = calloc(1, ADUCM_SPI_MSG_BUFF_SIZE);
+	if (NULL == adicup_desc->msg_buff) {
+		free(adicup_desc->buffer);
+		free(adicup_desc);
+		free(desc);
+		return NULL;
+	}
+
 	return desc;
 }
 
@@ -91,6 +100,7 @@ static struct spi_desc *alloc_data_mem(void)
  */
 static void free_desc_mem(struct spi_desc *desc)
 {
+	free(((struct aducm_spi_desc*)(desc->extra))->msg_buff);
 	free(((struct aducm_spi_desc*)(desc->extra))->buffer);
 	free(desc->extra);
 	free(desc);
@@ -228,3 +238,56 @@ int32_t spi_write_and_read(struct spi_desc *desc,
 	return SUCCESS;
 }
 
+/**
+ * @brief Transfer a message made of several segments. The driver asserts the
+ * chip select for each transaction, so the segments sharing a chip select
+ * frame are gathered into a single transaction (DMA if enabled).
+ * There is no delay implementation on this platform, a segment with
+ * "delay_usecs" set only ends the transaction.
+ * @param desc - The SPI descriptor.
+ * @param msgs - The segments of the message.
+ * @param msgs_number - Number of segments.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t spi_transfer_msgs(struct spi_desc *desc,
+			  struct spi_msg *msgs,
+			  uint32_t msgs_number)
+{
+	struct aducm_spi_desc	*adicup_desc = desc->extra;
+	uint32_t		first, i, len, offset;
+	int32_t			ret;
+
+	first = 0;
+	len = 0;
+	for (i = 0; i < msgs_number; i++) {
+		if (len + msgs[i].bytes_number > ADUCM_SPI_MSG_BUFF_SIZE)
+			return FAILURE;
+		if (msgs[i].tx_buff)
+			memcpy(adicup_desc->msg_buff + len, msgs[i].tx_buff,
+			       msgs[i].bytes_number);
+		else
+			memset(adicup_desc->msg_buff + len, 0, msgs[i].bytes_number);
+		len += msgs[i].bytes_number;
+
+		/* end of the chip select frame */
+		if (!msgs[i].cs_change && (i < msgs_number - 1) &&
+		    !msgs[i].delay_usecs)
+			continue;
+
+		if (len) {
+			ret = spi_write_and_read(desc, adicup_desc->msg_buff, len);
+			if (ret != SUCCESS)
+				return ret;
+		}
+
+		for (offset = 0; first <= i; first++) {
+			if (msgs[first].rx_buff)
+				memcpy(msgs[first].rx_buff, adicup_desc->msg_buff + offset,
+				       msgs[first].bytes_number);
+			offset += msgs[first].bytes_number;
+		}
+		len = 0;
+	}
+
+	return SUCCESS;
+}
@@ -45,6 +45,13 @@
 
 #include <drivers/spi/adi_spi.h>
 
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+/** Size of the buffer used to gather the segments of a message */
+#define ADUCM_SPI_MSG_BUFF_SIZE	256
+
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
@@ -106,6 +113,8 @@ struct aducm_spi_desc {
 	bool					dma;
 	/** RESERVED */
 	void					*buffer;
+	/** Gather buffer for spi_transfer_msgs() */
+	uint8_t					*msg_buff;
 	/** Handle to identify the SPI device */
 	ADI_SPI_HANDLE			spi_handle;
 };
@@ -77,3 +77,41 @@ int32_t axi_io_write(uint32_t base, uint32_t offset, uint32_t data)
 	return SUCCESS;
 }
 
+/**
+ * @brief AXI IO Altera specific block read function.
+ * @param base - Base address
+ * @param offset - Address offset
+ * @param data - buffer where the returned data is stored
+ * @param count - number of 32-bit words to be read
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_read_block(uint32_t base, uint32_t offset, uint32_t *data,
+			  uint32_t count)
+{
+	uint32_t i;
+
+	/* Keep the direct (cache bypassing) accesses of axi_io_read(). */
+	for (i = 0; i < count; i++)
+		data[i] = IORD_32DIRECT(base, offset + i * sizeof(*data));
+
+	return SUCCESS;
+}
+
+/**
+ * @brief AXI IO Altera specific block write function.
+ * @param base - Base address
+ * @param offset - Address offset
+ * @param data - data to be written
+ * @param count - number of 32-bit words to be written
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_write_block(uint32_t base, uint32_t offset,
+			   const uint32_t *data, uint32_t count)
+{
+	uint32_t i;
+
+	for (i = 0; i < count; i++)
+		IOWR_32DIRECT(base, offset + i * sizeof(*data), data[i]);
+
+	return SUCCESS;
+}
@@ -45,6 +45,7 @@
 #include <altera_avalon_spi_regs.h>
 #include "parameters.h"
 #include "error.h"
+#include "delay.h"
 #include "spi.h"
 #include "spi_extra.h"
 
@@ -155,4 +156,70 @@ int32_t spi_write_and_read(struct spi_desc *desc,
 	return SUCCESS;
 }
 
+/**
+ * @brief Transfer a message made of several segments. The chip select is
+ * forced for the whole message and released only after segments with
+ * "cs_change" set.
+ * @param desc - The SPI descriptor.
+ * @param msgs - The segments of the message.
+ * @param msgs_number - Number of segments.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t spi_transfer_msgs(struct spi_desc *desc,
+			  struct spi_msg *msgs,
+			  uint32_t msgs_number)
+{
+	uint32_t i, j;
+	uint8_t rx;
+	struct altera_spi_desc *altera_desc;
+
+	altera_desc = desc->extra;
 
+	switch(altera_desc->type) {
+	case NIOS_II_SPI:
+		IOWR_32DIRECT(altera_desc->base_address,
+			      (ALTERA_AVALON_SPI_SLAVE_SEL_REG * 4),
+			      (0x1 << (desc->chip_select)));
+		IOWR_32DIRECT(altera_desc->base_address,
+			      (ALTERA_AVALON_SPI_CONTROL_REG * 4),
+			      ALTERA_AVALON_SPI_CONTROL_SSO_MSK);
+		for (i = 0; i < msgs_number; i++) {
+			for (j = 0; j < msgs[i].bytes_number; j++) {
+				while ((IORD_32DIRECT(altera_desc->base_address,
+						      (ALTERA_AVALON_SPI_STATUS_REG * 4)) &
+					ALTERA_AVALON_SPI_STATUS_TRDY_MSK) == 0x00) {}
+				IOWR_32DIRECT(altera_desc->base_address,
+					      (ALTERA_AVALON_SPI_TXDATA_REG * 4),
+					      msgs[i].tx_buff ? msgs[i].tx_buff[j] : 0);
+				while ((IORD_32DIRECT(altera_desc->base_address,
+						      (ALTERA_AVALON_SPI_STATUS_REG * 4)) &
+					ALTERA_AVALON_SPI_STATUS_RRDY_MSK) == 0x00) {}
+				rx = IORD_32DIRECT(altera_desc->base_address,
+						   (ALTERA_AVALON_SPI_RXDATA_REG * 4));
+				if (msgs[i].rx_buff)
+					msgs[i].rx_buff[j] = rx;
+			}
+			if (msgs[i].cs_change && (i < msgs_number - 1)) {
+				IOWR_32DIRECT(altera_desc->base_address,
+					      (ALTERA_AVALON_SPI_CONTROL_REG * 4), 0x000);
+				if (msgs[i].delay_usecs)
+					udelay(msgs[i].delay_usecs);
+				IOWR_32DIRECT(altera_desc->base_address,
+					      (ALTERA_AVALON_SPI_CONTROL_REG * 4),
+					      ALTERA_AVALON_SPI_CONTROL_SSO_MSK);
+			} else if (msgs[i].delay_usecs) {
+				udelay(msgs[i].delay_usecs);
+			}
+		}
+		IOWR_32DIRECT(altera_desc->base_address,
+			      (ALTERA_AVALON_SPI_SLAVE_SEL_REG * 4), 0x000);
+		IOWR_32DIRECT(altera_desc->base_address,
+			      (ALTERA_AVALON_SPI_CONTROL_REG * 4), 0x000);
+
+		break;
+	default:
+		return FAILURE;
+	}
+
+	return SUCCESS;
+}
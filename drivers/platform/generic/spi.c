@@ -106,3 +106,29 @@ int32_t spi_write_and_read(struct spi_desc *desc,
 
 	return SUCCESS;
 }
+
+/**
+ * @brief Transfer a message made of several segments.
+ * @param desc - The SPI descriptor.
+ * @param msgs - The segments of the message.
+ * @param msgs_number - Number of segments.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t spi_transfer_msgs(struct spi_desc *desc,
+			  struct spi_msg *msgs,
+			  uint32_t msgs_number)
+{
+	if (desc) {
+		// Unused variable - fix compiler warning
+	}
+
+	if (msgs) {
+		// Unused variable - fix compiler warning
+	}
+
+	if (msgs_number) {
+		// Unused variable - fix compiler warning
+	}
+
+	return SUCCESS;
+}
@@ -43,69 +43,174 @@
 #include <fcntl.h>
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <sys/mman.h>
 #include "error.h"
 #include "axi_io.h"
+#include "axi_io_extra.h"
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+#define AXI_IO_DEFAULT_MAP_SIZE	0x10000
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @struct axi_io_map
+ * @brief Persistent mapping of an UIO device memory region.
+ */
+struct axi_io_map {
+	/** Start of the mapped region, NULL if the device is not mapped */
+	void		*addr;
+	/** Size of the mapped region */
+	uint32_t	size;
+};
+
+/******************************************************************************/
+/************************ Variables Definitions *******************************/
+/******************************************************************************/
+
+static struct axi_io_map axi_io_maps[AXI_IO_UIO_MAX];
 
 /******************************************************************************/
 /************************ Functions Definitions *******************************/
 /******************************************************************************/
 
 /**
- * @brief AXI IO through UIO read/write function.
+ * @brief Get the size of the first memory region of an UIO device.
+ * @param base - UIO index (/dev/uioX).
+ * @return The size reported by sysfs, AXI_IO_DEFAULT_MAP_SIZE if unavailable.
+ */
+static uint32_t axi_io_map_size(uint32_t base)
+{
+	char buf[64];
+	FILE *f;
+	uint32_t size;
+	int ret;
+
+	sprintf(buf, "/sys/class/uio/uio%"PRIu32"/maps/map0/size", base);
+
+	f = fopen(buf, "r");
+	if (!f)
+		return AXI_IO_DEFAULT_MAP_SIZE;
+
+	ret = fscanf(f, "%"SCNx32"", &size);
+	fclose(f);
+	if ((ret != 1) || !size)
+		return AXI_IO_DEFAULT_MAP_SIZE;
+
+	return size;
+}
+
+/**
+ * @brief Get the mapped address of a register, mapping the device on first
+ *        access.
  * @param base - UIO index (/dev/uioX).
  * @param offset - Address offset.
- * @param read - Location where read data will be stored.
- * @param write - Data to be written.
+ * @param len - Number of bytes that will be accessed starting at offset.
+ * @param addr - Location where the register address will be stored.
  * @return SUCCESS in case of success, FAILURE otherwise.
  */
-static int32_t axi_io_read_write(uint32_t base, uint32_t offset, uint32_t *read,
-				 uint32_t *write)
+int32_t axi_io_map_get(uint32_t base, uint32_t offset, uint32_t len,
+		       volatile void **addr)
 {
+	struct axi_io_map *map;
 	char buf[32];
-	int ret;
 	int uio_fd;
-	int32_t status = SUCCESS;
 	void *uio_addr;
+	uint32_t size;
 
-	sprintf(buf, "/dev/uio%"PRIu32"", base);
-
-	uio_fd = open(buf, O_RDWR);
-	if (uio_fd < 0) {
-		printf("%s: Can't open %s\n\r", __func__, buf);
+	if (base >= AXI_IO_UIO_MAX) {
+		printf("%s: Invalid UIO index %"PRIu32"\n\r", __func__, base);
 		return FAILURE;
 	}
 
-	uio_addr = mmap(NULL,
-			offset + sizeof(*read),
-			PROT_READ|PROT_WRITE,
-			MAP_SHARED,
-			uio_fd,
-			0);
-	if (uio_addr == MAP_FAILED) {
-		printf("%s: mmap() failed\n\r", __func__);
-		status = FAILURE;
-		goto close;
+	map = &axi_io_maps[base];
+	if (!map->addr) {
+		sprintf(buf, "/dev/uio%"PRIu32"", base);
+
+		uio_fd = open(buf, O_RDWR | O_SYNC);
+		if (uio_fd < 0) {
+			printf("%s: Can't open %s\n\r", __func__, buf);
+			return FAILURE;
+		}
+
+		size = axi_io_map_size(base);
+		uio_addr = mmap(NULL,
+				size,
+				PROT_READ|PROT_WRITE,
+				MAP_SHARED,
+				uio_fd,
+				0);
+
+		/* The mapping stays valid after the file is closed. */
+		if (close(uio_fd) < 0)
+			printf("%s: Can't close %s\n\r", __func__, buf);
+
+		if (uio_addr == MAP_FAILED) {
+			printf("%s: mmap() failed\n\r", __func__);
+			return FAILURE;
+		}
+
+		map->addr = uio_addr;
+		map->size = size;
+	}
+
+	if ((offset > map->size) || (len > map->size - offset)) {
+		printf("%s: Offset 0x%"PRIx32" out of range\n\r", __func__, offset);
+		return FAILURE;
 	}
 
-	if (read)
-		*read = *(uint32_t *)((uintptr_t)uio_addr + offset);
-	if (write)
-		*(uint32_t *)((uintptr_t)uio_addr + offset) = *write;
+	*addr = (volatile void *)((uintptr_t)map->addr + offset);
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Unmap the memory region of an UIO device.
+ * @param base - UIO index (/dev/uioX).
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_unmap(uint32_t base)
+{
+	struct axi_io_map *map;
+	int ret;
+
+	if (base >= AXI_IO_UIO_MAX)
+		return FAILURE;
+
+	map = &axi_io_maps[base];
+	if (!map->addr)
+		return SUCCESS;
 
-	ret = munmap(uio_addr, offset + sizeof(*read));
+	ret = munmap(map->addr, map->size);
+	map->addr = NULL;
+	map->size = 0;
 	if (ret < 0) {
 		printf("%s: munmap() failed\n\r", __func__);
-		status = FAILURE;
+		return FAILURE;
 	}
 
-close:
-	ret = close(uio_fd);
-	if (ret < 0) {
-		printf("%s: Can't close %s\n\r", __func__, buf);
-		status = FAILURE;
-	}
+	return SUCCESS;
+}
+
+/**
+ * @brief Unmap the memory regions of all the UIO devices accessed so far.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_unmap_all(void)
+{
+	int32_t status = SUCCESS;
+	uint32_t i;
+
+	for (i = 0; i < AXI_IO_UIO_MAX; i++)
+		if (axi_io_unmap(i) != SUCCESS)
+			status = FAILURE;
 
 	return status;
 }
@@ -119,7 +224,16 @@ close:
  */
 int32_t axi_io_read(uint32_t base, uint32_t offset, uint32_t *data)
 {
-	return axi_io_read_write(base, offset, data, NULL);
+	volatile void *addr;
+	int32_t ret;
+
+	ret = axi_io_map_get(base, offset, sizeof(*data), &addr);
+	if (ret != SUCCESS)
+		return ret;
+
+	*data = *(volatile uint32_t *)addr;
+
+	return SUCCESS;
 }
 
 /**
@@ -131,5 +245,60 @@ int32_t axi_io_read(uint32_t base, uint32_t offset, uint32_t *data)
  */
 int32_t axi_io_write(uint32_t base, uint32_t offset, uint32_t data)
 {
-	return axi_io_read_write(base, offset, NULL, &data);
+	volatile void *addr;
+	int32_t ret;
+
+	ret = axi_io_map_get(base, offset, sizeof(data), &addr);
+	if (ret != SUCCESS)
+		return ret;
+
+	*(volatile uint32_t *)addr = data;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief AXI IO through UIO block read function.
+ * @param base - UIO index (/dev/uioX).
+ * @param offset - Address offset.
+ * @param data - Buffer where the read data will be stored.
+ * @param count - Number of 32-bit words to be read.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_read_block(uint32_t base, uint32_t offset, uint32_t *data,
+			  uint32_t count)
+{
+	volatile void *addr;
+	int32_t ret;
+
+	ret = axi_io_map_get(base, offset, count * sizeof(*data), &addr);
+	if (ret != SUCCESS)
+		return ret;
+
+	memcpy(data, (void *)addr, count * sizeof(*data));
+
+	return SUCCESS;
+}
+
+/**
+ * @brief AXI IO through UIO block write function.
+ * @param base - UIO index (/dev/uioX).
+ * @param offset - Address offset.
+ * @param data - Data to be written.
+ * @param count - Number of 32-bit words to be written.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_write_block(uint32_t base, uint32_t offset,
+			   const uint32_t *data, uint32_t count)
+{
+	volatile void *addr;
+	int32_t ret;
+
+	ret = axi_io_map_get(base, offset, count * sizeof(*data), &addr);
+	if (ret != SUCCESS)
+		return ret;
+
+	memcpy((void *)addr, data, count * sizeof(*data));
+
+	return SUCCESS;
 }
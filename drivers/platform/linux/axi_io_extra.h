@@ -1,9 +1,8 @@
 /***************************************************************************//**
- *   @file   fifo.h
- *   @brief  Implementation of fifo
- *   @author Cristian Pop (cristian.pop@analog.com)
+ *   @file   linux/axi_io_extra.h
+ *   @brief  Header file of Linux specific AXI IO through UIO.
 ********************************************************************************
- * Copyright 2019(c) Analog Devices, Inc.
+ * Copyright 2020(c) Analog Devices, Inc.
  *
  * All rights reserved.
  *
@@ -36,8 +35,9 @@
  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *******************************************************************************/
-#ifndef FIFO_H_
-#define FIFO_H_
+
+#ifndef AXI_IO_EXTRA_H_
+#define AXI_IO_EXTRA_H_
 
 /******************************************************************************/
 /***************************** Include Files **********************************/
@@ -46,30 +46,24 @@
 #include <stdint.h>
 
 /******************************************************************************/
-/*************************** Types Declarations *******************************/
+/********************** Macros and Constants Definitions **********************/
 /******************************************************************************/
 
-/**
- * @struct fifo_element
- * @brief Structure holding the fifo element parameters.
- */
-struct fifo_element {
-	/** next FIFO element */
-	struct fifo_element *next;
-	/** FIFO data pointer */
-	char *data;
-	/** FIFO length */
-	uint32_t len;
-};
+/* Number of UIO devices (/dev/uio0 ... /dev/uioN) that can be mapped. */
+#define AXI_IO_UIO_MAX	64
 
 /******************************************************************************/
 /************************ Functions Declarations ******************************/
 /******************************************************************************/
 
-/* Insert element to fifo tail. */
-int32_t fifo_insert(struct fifo_element **p_fifo, char *buff, uint32_t len);
+/* Get the mapped address of a register, mapping the UIO device if needed. */
+int32_t axi_io_map_get(uint32_t base, uint32_t offset, uint32_t len,
+		       volatile void **addr);
+
+/* Unmap the memory region of an UIO device. */
+int32_t axi_io_unmap(uint32_t base);
 
-/* Remove fifo head. */
-struct fifo_element *fifo_remove(struct fifo_element *p_fifo);
+/* Unmap the memory regions of all the UIO devices. */
+int32_t axi_io_unmap_all(void);
 
-#endif /* FIFO_H_ */
+#endif // AXI_IO_EXTRA_H_
@@ -44,11 +44,23 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
 #include "platform_drivers.h"
 #include <linux/i2c-dev.h>
 #include <linux/spi/spidev.h>
+#include <linux/gpio.h>
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+/* Messages up to this number of segments are built on the stack. */
+#define SPI_MSG_STACK_SEGMENTS	16
+
+/* Line request direction that keeps the current direction and value. */
+#define GPIO_AS_IS		0xFF
 
 /******************************************************************************/
 /************************ Functions Definitions *******************************/
@@ -268,123 +280,241 @@ int32_t spi_write_and_read(spi_desc *desc,
 }
 
 /**
- * @brief Obtain the GPIO decriptor.
- * @param desc - The GPIO descriptor.
- * @param gpio_number - The number of the GPIO.
+ * @brief Transfer a message made of several segments, with a single
+ * SPI_IOC_MESSAGE(n) call.
+ * @param desc - The SPI descriptor.
+ * @param msgs - The segments of the message.
+ * @param msgs_number - Number of segments.
  * @return SUCCESS in case of success, FAILURE otherwise.
  */
-int32_t gpio_get(gpio_desc **desc,
-		 uint8_t gpio_number)
+int32_t spi_transfer_msgs(spi_desc *desc,
+			  spi_msg *msgs,
+			  uint32_t msgs_number)
 {
-	gpio_desc *descriptor;
-	char buf[100];
-	int fd;
-	int len;
+	struct spi_ioc_transfer stack_tr[SPI_MSG_STACK_SEGMENTS];
+	struct spi_ioc_transfer *tr = stack_tr;
+	uint32_t i;
 	int ret;
 
-	descriptor = (gpio_desc *)malloc(sizeof(*descriptor));
-	if (!descriptor)
-		return FAILURE;
+	if (!msgs_number)
+		return SUCCESS;
 
-	descriptor->number = gpio_number;
-
-	fd = open("/sys/class/gpio/export", O_WRONLY);
-	if (fd < 0) {
-		printf("%s: Can't open device\n\r", __func__);
-		free(descriptor);
-		return FAILURE;
+	if (msgs_number > SPI_MSG_STACK_SEGMENTS) {
+		tr = (struct spi_ioc_transfer *)calloc(msgs_number, sizeof(*tr));
+		if (!tr)
+			return FAILURE;
+	} else {
+		memset(tr, 0, msgs_number * sizeof(*tr));
 	}
 
-	len = sprintf(buf, "%d", gpio_number);
-	ret = write(fd, buf, len);
-	if (ret < 0) {
-		printf("%s: Can't write to file\n\r", __func__);
-		close(fd);
-		free(descriptor);
-		return FAILURE;
+	for (i = 0; i < msgs_number; i++) {
+		tr[i].tx_buf = (unsigned long)msgs[i].tx_buff;
+		tr[i].rx_buf = (unsigned long)msgs[i].rx_buff;
+		tr[i].len = msgs[i].bytes_number;
+		tr[i].delay_usecs = msgs[i].delay_usecs;
+		/* on the last transfer cs_change would keep the CS asserted */
+		tr[i].cs_change = (i < msgs_number - 1) ? msgs[i].cs_change : 0;
 	}
 
-	ret = close(fd);
+	ret = ioctl(desc->fd, SPI_IOC_MESSAGE(msgs_number), tr);
+
+	if (tr != stack_tr)
+		free(tr);
+
 	if (ret < 0) {
-		printf("%s: Can't close device\n\r", __func__);
-		free(descriptor);
+		printf("%s: Can't send spi message\n\r", __func__);
 		return FAILURE;
 	}
 
-	*desc = descriptor;
-
 	return SUCCESS;
 }
 
 /**
- * @brief Free the resources allocated by gpio_get().
- * @param desc - The SPI descriptor.
- * @return SUCCESS in case of success, FAILURE otherwise.
+ * @brief Request a line handle for lines of a GPIO chip.
+ * @param chip_fd - The GPIO chip file descriptor.
+ * @param offsets - The offsets of the lines on the chip.
+ * @param lines_number - Number of lines.
+ * @param direction - The direction of the lines, GPIO_AS_IS to keep the
+ *                    current one.
+ * @param values - The initial values of the output lines, may be NULL.
+ * @return The line handle in case of success, FAILURE otherwise.
  */
-int32_t gpio_remove(gpio_desc *desc)
+static int gpio_request_lines(int chip_fd,
+			      const uint8_t *offsets,
+			      uint8_t lines_number,
+			      uint8_t direction,
+			      const uint8_t *values)
 {
-	char buf[100];
-	int fd;
-	int len;
+	struct gpiohandle_request req;
+	uint8_t i;
 	int ret;
 
-	fd = open("/sys/class/gpio/unexport", O_WRONLY);
-	if (fd < 0) {
-		printf("%s: Can't open device\n\r", __func__);
+	if (!lines_number || lines_number > GPIO_GROUP_MAX_LINES)
 		return FAILURE;
+
+	memset(&req, 0, sizeof(req));
+	for (i = 0; i < lines_number; i++) {
+		req.lineoffsets[i] = offsets[i];
+		if (values)
+			req.default_values[i] = values[i] ? 1 : 0;
 	}
+	req.lines = lines_number;
+	if (direction == GPIO_OUT)
+		req.flags = GPIOHANDLE_REQUEST_OUTPUT;
+	else if (direction == GPIO_IN)
+		req.flags = GPIOHANDLE_REQUEST_INPUT;
+	strncpy(req.consumer_label, "no-OS", sizeof(req.consumer_label) - 1);
 
-	len = sprintf(buf, "%d", desc->number);
-	ret = write(fd, buf, len);
-	if (ret < 0) {
-		printf("%s: Can't write to file\n\r", __func__);
+	ret = ioctl(chip_fd, GPIO_GET_LINEHANDLE_IOCTL, &req);
+	if (ret < 0)
 		return FAILURE;
+
+	return req.fd;
+}
+
+/**
+ * @brief Request again the line handle of a GPIO with a new direction.
+ * @param desc - The GPIO descriptor.
+ * @param direction - The direction.
+ * @param value - The initial value if the direction is output.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+static int32_t gpio_request(gpio_desc *desc,
+			    uint8_t direction,
+			    uint8_t value)
+{
+	int fd;
+
+	/* The line stays owned by the old handle until it is closed. */
+	if (desc->fd >= 0) {
+		close(desc->fd);
+		desc->fd = -1;
 	}
 
-	ret = close(fd);
-	if (ret < 0) {
-		printf("%s: Can't close device\n\r", __func__);
+	fd = gpio_request_lines(desc->chip_fd, &desc->number, 1, direction,
+				&value);
+	if (fd < 0) {
+		printf("%s: Can't request line %d\n\r", __func__, desc->number);
 		return FAILURE;
 	}
 
-	free(desc);
+	desc->fd = fd;
+	desc->direction = direction;
 
 	return SUCCESS;
 }
 
 /**
- * @brief Enable the input direction of the specified GPIO.
+ * @brief Request the line handle of a GPIO not requested yet, keeping the
+ * current direction and, for an output, the driven value.
  * @param desc - The GPIO descriptor.
  * @return SUCCESS in case of success, FAILURE otherwise.
  */
-int32_t gpio_direction_input(gpio_desc *desc)
+static int32_t gpio_request_as_is(gpio_desc *desc)
 {
-	char buf[100];
+	uint8_t direction;
+	int32_t ret;
 	int fd;
-	int ret;
 
-	sprintf(buf, "/sys/class/gpio/gpio%d/direction", desc->number);
-	fd = open(buf, O_WRONLY);
+	ret = gpio_get_direction(desc, &direction);
+	if (ret != SUCCESS)
+		return ret;
+
+	fd = gpio_request_lines(desc->chip_fd, &desc->number, 1, GPIO_AS_IS,
+				NULL);
 	if (fd < 0) {
-		printf("%s: Can't open device\n\r", __func__);
+		printf("%s: Can't request line %d\n\r", __func__, desc->number);
 		return FAILURE;
 	}
 
-	ret = write(fd, "in", 3);
-	if (ret < 0) {
-		printf("%s: Can't write to file\n\r", __func__);
+	desc->fd = fd;
+	desc->direction = direction;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Obtain the GPIO decriptor of a line of the specified GPIO chip.
+ * The chip is kept open, the line is requested on the first direction
+ * change or access.
+ * @param desc - The GPIO descriptor.
+ * @param chip - The GPIO chip character device (e.g. /dev/gpiochip0).
+ * @param offset - The offset of the line on the chip.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t gpio_get_line(gpio_desc **desc,
+		      const char *chip,
+		      uint8_t offset)
+{
+	gpio_desc *descriptor;
+
+	descriptor = (gpio_desc *)malloc(sizeof(*descriptor));
+	if (!descriptor)
+		return FAILURE;
+
+	descriptor->type = GENERIC_GPIO;
+	descriptor->id = 0;
+	descriptor->number = offset;
+	descriptor->fd = -1;
+	descriptor->direction = GPIO_IN;
+
+	descriptor->chip_fd = open(chip, O_RDWR);
+	if (descriptor->chip_fd < 0) {
+		printf("%s: Can't open device\n\r", __func__);
+		free(descriptor);
 		return FAILURE;
 	}
 
-	ret = close(fd);
+	*desc = descriptor;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Obtain the GPIO decriptor.
+ * @param desc - The GPIO descriptor.
+ * @param gpio_number - The number of the GPIO, the line offset on
+ *                      GPIO_CHIP_DEFAULT.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t gpio_get(gpio_desc **desc,
+		 uint8_t gpio_number)
+{
+	return gpio_get_line(desc, GPIO_CHIP_DEFAULT, gpio_number);
+}
+
+/**
+ * @brief Free the resources allocated by gpio_get().
+ * @param desc - The GPIO descriptor.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t gpio_remove(gpio_desc *desc)
+{
+	int ret = 0;
+
+	if (desc->fd >= 0)
+		ret = close(desc->fd);
+	ret |= close(desc->chip_fd);
 	if (ret < 0) {
 		printf("%s: Can't close device\n\r", __func__);
 		return FAILURE;
 	}
 
+	free(desc);
+
 	return SUCCESS;
 }
 
+/**
+ * @brief Enable the input direction of the specified GPIO.
+ * @param desc - The GPIO descriptor.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t gpio_direction_input(gpio_desc *desc)
+{
+	return gpio_request(desc, GPIO_IN, 0);
+}
+
 /**
  * @brief Enable the output direction of the specified GPIO.
  * @param desc - The GPIO descriptor.
@@ -396,36 +526,10 @@ int32_t gpio_direction_input(gpio_desc *desc)
 int32_t gpio_direction_output(gpio_desc *desc,
 			      uint8_t value)
 {
-	char buf[100];
-	int fd;
-	int ret;
-
-	sprintf(buf, "/sys/class/gpio/gpio%d/direction", desc->number);
-	fd = open(buf, O_WRONLY);
-	if (fd < 0) {
-		printf("%s: Can't open device\n\r", __func__);
-		return FAILURE;
-	}
+	if (desc->fd >= 0 && desc->direction == GPIO_OUT)
+		return gpio_set_value(desc, value);
 
-	ret = write(fd, "out", 4);
-	if (ret < 0) {
-		printf("%s: Can't write to file\n\r", __func__);
-		return FAILURE;
-	}
-
-	ret = close(fd);
-	if (ret < 0) {
-		printf("%s: Can't close device\n\r", __func__);
-		return FAILURE;
-	}
-
-	ret = gpio_set_value(desc, value);
-	if (ret != SUCCESS) {
-		printf("%s: Can't set value\n\r", __func__);
-		return FAILURE;
-	}
-
-	return SUCCESS;
+	return gpio_request(desc, GPIO_OUT, value);
 }
 
 /**
@@ -439,40 +543,33 @@ int32_t gpio_direction_output(gpio_desc *desc,
 int32_t gpio_get_direction(gpio_desc *desc,
 			   uint8_t *direction)
 {
-	char buf[100];
-	char data;
-	int fd;
+	struct gpioline_info info;
 	int ret;
 
-	sprintf(buf, "/sys/class/gpio/gpio%d/direction", desc->number);
-	fd = open(buf, O_RDONLY);
-	if (fd < 0) {
-		printf("%s: Can't open file\n\r", __func__);
-		return FAILURE;
+	if (desc->fd >= 0) {
+		*direction = desc->direction;
+		return SUCCESS;
 	}
 
-	ret = read(fd, &data, 1);
+	memset(&info, 0, sizeof(info));
+	info.line_offset = desc->number;
+	ret = ioctl(desc->chip_fd, GPIO_GET_LINEINFO_IOCTL, &info);
 	if (ret < 0) {
-		printf("%s: Can't read from file\n\r", __func__);
+		printf("%s: Can't get line info\n\r", __func__);
 		return FAILURE;
 	}
 
-	if(data == 'o')
+	if (info.flags & GPIOLINE_FLAG_IS_OUT)
 		*direction = GPIO_OUT;
 	else
 		*direction = GPIO_IN;
 
-	ret = close(fd);
-	if (ret < 0) {
-		printf("%s: Can't close device\n\r", __func__);
-		return FAILURE;
-	}
-
 	return SUCCESS;
 }
 
 /**
- * @brief Set the value of the specified GPIO.
+ * @brief Set the value of the specified GPIO. The GPIO must be an output, as
+ * with sysfs the direction is not changed.
  * @param desc - The GPIO descriptor.
  * @param value - The value.
  *                Example: GPIO_HIGH
@@ -482,29 +579,34 @@ int32_t gpio_get_direction(gpio_desc *desc,
 int32_t gpio_set_value(gpio_desc *desc,
 		       uint8_t value)
 {
-	char buf[100];
-	int fd;
+	struct gpiohandle_data data;
+	uint8_t direction;
 	int ret;
 
-	sprintf(buf, "/sys/class/gpio/gpio%d/value", desc->number);
-	fd = open(buf, O_WRONLY);
-	if (fd < 0) {
-		printf("%s: Can't open device\n\r", __func__);
-		return FAILURE;
+	if (desc->fd < 0) {
+		/* Not requested yet, take over the line if already an output. */
+		ret = gpio_get_direction(desc, &direction);
+		if (ret != SUCCESS)
+			return ret;
+		if (direction != GPIO_OUT) {
+			printf("%s: Line %d is an input\n\r", __func__,
+			       desc->number);
+			return FAILURE;
+		}
+
+		return gpio_request(desc, GPIO_OUT, value);
 	}
 
-	if (value)
-		ret = write(fd, "1", 2);
-	else
-		ret = write(fd, "0", 2);
-	if (ret < 0) {
-		printf("%s: Can't write to file\n\r", __func__);
+	if (desc->direction != GPIO_OUT) {
+		printf("%s: Line %d is an input\n\r", __func__, desc->number);
 		return FAILURE;
 	}
 
-	ret = close(fd);
+	memset(&data, 0, sizeof(data));
+	data.values[0] = value ? 1 : 0;
+	ret = ioctl(desc->fd, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &data);
 	if (ret < 0) {
-		printf("%s: Can't close device\n\r", __func__);
+		printf("%s: Can't set value\n\r", __func__);
 		return FAILURE;
 	}
 
@@ -522,35 +624,151 @@ int32_t gpio_set_value(gpio_desc *desc,
 int32_t gpio_get_value(gpio_desc *desc,
 		       uint8_t *value)
 {
-	char buf[100];
-	char data;
-	int fd;
+	struct gpiohandle_data data;
 	int ret;
 
-	sprintf(buf, "/sys/class/gpio/gpio%d/value", desc->number);
-	fd = open(buf, O_RDONLY);
-	if (fd < 0) {
-		printf("%s: Can't open file\n\r", __func__);
-		return FAILURE;
+	if (desc->fd < 0) {
+		/* Not requested yet, an output keeps driving its value. */
+		ret = gpio_request_as_is(desc);
+		if (ret != SUCCESS)
+			return ret;
 	}
 
-	ret = read(fd, &data, 1);
+	memset(&data, 0, sizeof(data));
+	ret = ioctl(desc->fd, GPIOHANDLE_GET_LINE_VALUES_IOCTL, &data);
 	if (ret < 0) {
-		printf("%s: Can't read from file\n\r", __func__);
+		printf("%s: Can't get value\n\r", __func__);
 		return FAILURE;
 	}
 
-	if(data == '0')
-		*value = GPIO_LOW;
-	else
-		*value = GPIO_HIGH;
+	*value = data.values[0] ? GPIO_HIGH : GPIO_LOW;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Obtain a descriptor for several lines of a GPIO chip, requested as
+ * one line handle so they are set or read together with one syscall.
+ * @param desc - The GPIO group descriptor.
+ * @param chip - The GPIO chip character device (e.g. /dev/gpiochip0).
+ * @param offsets - The offsets of the lines on the chip.
+ * @param lines_number - Number of lines, up to GPIO_GROUP_MAX_LINES.
+ * @param direction - The direction of all the lines.
+ *                    Example: GPIO_OUT
+ *                             GPIO_IN
+ * @param values - The initial values of the output lines, may be NULL.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t gpio_group_get(gpio_group_desc **desc,
+		       const char *chip,
+		       const uint8_t *offsets,
+		       uint8_t lines_number,
+		       uint8_t direction,
+		       const uint8_t *values)
+{
+	gpio_group_desc *descriptor;
 
-	ret = close(fd);
+	descriptor = (gpio_group_desc *)malloc(sizeof(*descriptor));
+	if (!descriptor)
+		return FAILURE;
+
+	descriptor->chip_fd = open(chip, O_RDWR);
+	if (descriptor->chip_fd < 0) {
+		printf("%s: Can't open device\n\r", __func__);
+		free(descriptor);
+		return FAILURE;
+	}
+
+	descriptor->fd = gpio_request_lines(descriptor->chip_fd, offsets,
+					    lines_number, direction, values);
+	if (descriptor->fd < 0) {
+		printf("%s: Can't request lines\n\r", __func__);
+		close(descriptor->chip_fd);
+		free(descriptor);
+		return FAILURE;
+	}
+
+	descriptor->lines_number = lines_number;
+	descriptor->direction = direction;
+
+	*desc = descriptor;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Free the resources allocated by gpio_group_get().
+ * @param desc - The GPIO group descriptor.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t gpio_group_remove(gpio_group_desc *desc)
+{
+	int ret;
+
+	ret = close(desc->fd);
+	ret |= close(desc->chip_fd);
 	if (ret < 0) {
 		printf("%s: Can't close device\n\r", __func__);
 		return FAILURE;
 	}
 
+	free(desc);
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Set the values of all the lines of a group, with a single syscall.
+ * @param desc - The GPIO group descriptor.
+ * @param values - The values, in the order of the offsets of the group.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t gpio_group_set_values(gpio_group_desc *desc,
+			      const uint8_t *values)
+{
+	struct gpiohandle_data data;
+	uint8_t i;
+	int ret;
+
+	if (desc->direction != GPIO_OUT)
+		return FAILURE;
+
+	memset(&data, 0, sizeof(data));
+	for (i = 0; i < desc->lines_number; i++)
+		data.values[i] = values[i] ? 1 : 0;
+
+	ret = ioctl(desc->fd, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &data);
+	if (ret < 0) {
+		printf("%s: Can't set values\n\r", __func__);
+		return FAILURE;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Get the values of all the lines of a group, with a single syscall.
+ * @param desc - The GPIO group descriptor.
+ * @param values - The values, in the order of the offsets of the group.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t gpio_group_get_values(gpio_group_desc *desc,
+			      uint8_t *values)
+{
+	struct gpiohandle_data data;
+	uint8_t i;
+	int ret;
+
+	memset(&data, 0, sizeof(data));
+	ret = ioctl(desc->fd, GPIOHANDLE_GET_LINE_VALUES_IOCTL, &data);
+	if (ret < 0) {
+		printf("%s: Can't get values\n\r", __func__);
+		return FAILURE;
+	}
+
+	for (i = 0; i < desc->lines_number; i++)
+		values[i] = data.values[i] ? GPIO_HIGH : GPIO_LOW;
+
 	return SUCCESS;
 }
 
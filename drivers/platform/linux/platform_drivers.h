@@ -56,6 +56,20 @@
 #define GPIO_HIGH	0x01
 #define GPIO_LOW	0x00
 
+/*
+ * GPIO chip used by gpio_get(). The GPIO number is the line offset on this
+ * chip, not the global number of the former sysfs backend: a GPIO exported as
+ * /sys/class/gpio/gpioN is line N - base, with base read from
+ * /sys/class/gpio/gpiochipX/base. Lines of other chips are obtained with
+ * gpio_get_line().
+ */
+#ifndef GPIO_CHIP_DEFAULT
+#define GPIO_CHIP_DEFAULT	"/dev/gpiochip0"
+#endif
+
+/* Maximum number of lines of a GPIO group (GPIOHANDLES_MAX). */
+#define GPIO_GROUP_MAX_LINES	64
+
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
@@ -109,6 +123,14 @@ typedef struct {
 	uint8_t		chip_select;
 } spi_desc;
 
+typedef struct {
+	uint8_t		*tx_buff;
+	uint8_t		*rx_buff;
+	uint32_t	bytes_number;
+	uint8_t		cs_change;
+	uint32_t	delay_usecs;
+} spi_msg;
+
 typedef enum {
 	GENERIC_GPIO
 } gpio_type;
@@ -117,8 +139,22 @@ typedef struct {
 	gpio_type	type;
 	uint32_t	id;
 	uint8_t		number;
+	/* GPIO chip character device */
+	int		chip_fd;
+	/* Line handle, -1 until the line is requested */
+	int		fd;
+	uint8_t		direction;
 } gpio_desc;
 
+typedef struct {
+	/* GPIO chip character device */
+	int		chip_fd;
+	/* Line handle of all the lines of the group */
+	int		fd;
+	uint8_t		lines_number;
+	uint8_t		direction;
+} gpio_group_desc;
+
 /******************************************************************************/
 /************************ Functions Declarations ******************************/
 /******************************************************************************/
@@ -154,10 +190,20 @@ int32_t spi_write_and_read(spi_desc *desc,
 			   uint8_t *data,
 			   uint8_t bytes_number);
 
-/* Obtain the GPIO decriptor. */
+/* Transfer a message made of several segments. */
+int32_t spi_transfer_msgs(spi_desc *desc,
+			  spi_msg *msgs,
+			  uint32_t msgs_number);
+
+/* Obtain the GPIO decriptor of a line offset of GPIO_CHIP_DEFAULT. */
 int32_t gpio_get(gpio_desc **desc,
 		 uint8_t gpio_number);
 
+/* Obtain the GPIO decriptor of a line of the specified GPIO chip. */
+int32_t gpio_get_line(gpio_desc **desc,
+		      const char *chip,
+		      uint8_t offset);
+
 /* Free the resources allocated by gpio_get() */
 int32_t gpio_remove(gpio_desc *desc);
 
@@ -172,7 +218,7 @@ int32_t gpio_direction_output(gpio_desc *desc,
 int32_t gpio_get_direction(gpio_desc *desc,
 			   uint8_t *direction);
 
-/* Set the value of the specified GPIO. */
+/* Set the value of the specified GPIO, fails if it is not an output. */
 int32_t gpio_set_value(gpio_desc *desc,
 		       uint8_t value);
 
@@ -180,6 +226,25 @@ int32_t gpio_set_value(gpio_desc *desc,
 int32_t gpio_get_value(gpio_desc *desc,
 		       uint8_t *value);
 
+/* Obtain a descriptor for several lines of a GPIO chip, updated together. */
+int32_t gpio_group_get(gpio_group_desc **desc,
+		       const char *chip,
+		       const uint8_t *offsets,
+		       uint8_t lines_number,
+		       uint8_t direction,
+		       const uint8_t *values);
+
+/* Free the resources allocated by gpio_group_get(). */
+int32_t gpio_group_remove(gpio_group_desc *desc);
+
+/* Set the values of all the lines of a group, with a single syscall. */
+int32_t gpio_group_set_values(gpio_group_desc *desc,
+			      const uint8_t *values);
+
+/* Get the values of all the lines of a group, with a single syscall. */
+int32_t gpio_group_get_values(gpio_group_desc *desc,
+			      uint8_t *values);
+
 /* Generate microseconds delay. */
 void udelay(uint32_t usecs);
 
@@ -0,0 +1,348 @@
+/***************************************************************************//**
+ *   @file   sim/axi_io.c
+ *   @brief  Implementation of host simulation AXI IO register models.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "error.h"
+#include "axi_io.h"
+#include "axi_io_extra.h"
+#include "sim_stats.h"
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @struct sim_axi_io_dev
+ * @brief Modeled AXI device.
+ */
+struct sim_axi_io_dev {
+	/** Base address, as passed to axi_io_read()/axi_io_write() */
+	uint32_t			base;
+	/** Size of the register space in bytes */
+	uint32_t			size;
+	/** Register file, NULL if the slot is free */
+	uint32_t			*regs;
+	/** Behaviour callbacks, may be NULL */
+	const struct sim_axi_io_ops	*ops;
+	/** Argument of the callbacks */
+	void				*ctx;
+};
+
+/******************************************************************************/
+/************************ Variables Definitions *******************************/
+/******************************************************************************/
+
+static struct sim_axi_io_dev sim_axi_io_devs[SIM_AXI_IO_MAX_DEVICES];
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Find the modeled device at a base address.
+ * @param base - Base address.
+ * @return The device, NULL if no device is modeled at that address.
+ */
+static struct sim_axi_io_dev *sim_axi_io_find(uint32_t base)
+{
+	uint32_t i;
+
+	for (i = 0; i < SIM_AXI_IO_MAX_DEVICES; i++)
+		if (sim_axi_io_devs[i].regs && sim_axi_io_devs[i].base == base)
+			return &sim_axi_io_devs[i];
+
+	return NULL;
+}
+
+/**
+ * @brief Add a modeled AXI device at the specified base address.
+ * @param base - Base address.
+ * @param size - Size of the register space in bytes.
+ * @param ops - Behaviour callbacks, NULL for a plain register file.
+ * @param ctx - Argument of the callbacks.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t sim_axi_io_add(uint32_t base, uint32_t size,
+		       const struct sim_axi_io_ops *ops, void *ctx)
+{
+	struct sim_axi_io_dev *dev = NULL;
+	uint32_t i;
+
+	if (!size || sim_axi_io_find(base))
+		return FAILURE;
+
+	for (i = 0; i < SIM_AXI_IO_MAX_DEVICES; i++) {
+		if (!sim_axi_io_devs[i].regs) {
+			dev = &sim_axi_io_devs[i];
+			break;
+		}
+	}
+	if (!dev)
+		return FAILURE;
+
+	dev->regs = (uint32_t *)calloc((size + 3) / 4, sizeof(*dev->regs));
+	if (!dev->regs)
+		return FAILURE;
+
+	dev->base = base;
+	dev->size = size;
+	dev->ops = ops;
+	dev->ctx = ctx;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Remove a modeled AXI device.
+ * @param base - Base address.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t sim_axi_io_remove(uint32_t base)
+{
+	struct sim_axi_io_dev *dev;
+
+	dev = sim_axi_io_find(base);
+	if (!dev)
+		return FAILURE;
+
+	free(dev->regs);
+	dev->regs = NULL;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Get the register file of a modeled AXI device, to preset or check
+ * registers from the harness without counting transactions.
+ * @param base - Base address.
+ * @return The register file, NULL if no device is modeled at that address.
+ */
+uint32_t *sim_axi_io_regs(uint32_t base)
+{
+	struct sim_axi_io_dev *dev;
+
+	dev = sim_axi_io_find(base);
+
+	return dev ? dev->regs : NULL;
+}
+
+/**
+ * @brief Get the modeled device and check the accessed range.
+ * @param base - Base address.
+ * @param offset - Address offset.
+ * @param count - Number of 32-bit words accessed.
+ * @return The device, NULL in case of error.
+ */
+static struct sim_axi_io_dev *sim_axi_io_get(uint32_t base, uint32_t offset,
+		uint32_t count)
+{
+	struct sim_axi_io_dev *dev;
+
+	dev = sim_axi_io_find(base);
+	if (!dev) {
+		printf("%s: No device at 0x%"PRIx32"\n\r", __func__, base);
+		return NULL;
+	}
+
+	if ((offset & 0x3) || (offset > dev->size) ||
+	    (count > (dev->size - offset) / 4)) {
+		printf("%s: Offset 0x%"PRIx32" out of range\n\r", __func__, offset);
+		return NULL;
+	}
+
+	return dev;
+}
+
+/**
+ * @brief Read a register of a modeled device.
+ * @param dev - The device.
+ * @param offset - Address offset.
+ * @param data - Location where read data will be stored.
+ * @return SUCCESS in case of success, negative error code otherwise.
+ */
+static int32_t sim_axi_io_reg_read(struct sim_axi_io_dev *dev,
+				   uint32_t offset, uint32_t *data)
+{
+	if (dev->ops && dev->ops->read)
+		return dev->ops->read(dev->ctx, dev->regs, offset, data);
+
+	*data = dev->regs[offset / 4];
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Write a register of a modeled device.
+ * @param dev - The device.
+ * @param offset - Address offset.
+ * @param data - Data to be written.
+ * @return SUCCESS in case of success, negative error code otherwise.
+ */
+static int32_t sim_axi_io_reg_write(struct sim_axi_io_dev *dev,
+				    uint32_t offset, uint32_t data)
+{
+	if (dev->ops && dev->ops->write)
+		return dev->ops->write(dev->ctx, dev->regs, offset, data);
+
+	dev->regs[offset / 4] = data;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief AXI IO read from a modeled device.
+ * @param base - Base address.
+ * @param offset - Address offset.
+ * @param data - Location where read data will be stored.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_read(uint32_t base, uint32_t offset, uint32_t *data)
+{
+	struct sim_stats *stats = sim_stats_get();
+	struct sim_axi_io_dev *dev;
+	uint64_t start = sim_time_ns();
+	int32_t ret;
+
+	dev = sim_axi_io_get(base, offset, 1);
+	if (!dev)
+		return FAILURE;
+
+	ret = sim_axi_io_reg_read(dev, offset, data);
+
+	stats->axi_reads++;
+	stats->axi_bus_ns += SIM_AXI_IO_ACCESS_NS;
+	stats->axi_host_ns += sim_time_ns() - start;
+
+	return ret;
+}
+
+/**
+ * @brief AXI IO write to a modeled device.
+ * @param base - Base address.
+ * @param offset - Address offset.
+ * @param data - Data to be written.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_write(uint32_t base, uint32_t offset, uint32_t data)
+{
+	struct sim_stats *stats = sim_stats_get();
+	struct sim_axi_io_dev *dev;
+	uint64_t start = sim_time_ns();
+	int32_t ret;
+
+	dev = sim_axi_io_get(base, offset, 1);
+	if (!dev)
+		return FAILURE;
+
+	ret = sim_axi_io_reg_write(dev, offset, data);
+
+	stats->axi_writes++;
+	stats->axi_bus_ns += SIM_AXI_IO_ACCESS_NS;
+	stats->axi_host_ns += sim_time_ns() - start;
+
+	return ret;
+}
+
+/**
+ * @brief AXI IO block read from a modeled device.
+ * @param base - Base address.
+ * @param offset - Address offset.
+ * @param data - Buffer where the read data will be stored.
+ * @param count - Number of 32-bit words to be read.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_read_block(uint32_t base, uint32_t offset, uint32_t *data,
+			  uint32_t count)
+{
+	struct sim_stats *stats = sim_stats_get();
+	struct sim_axi_io_dev *dev;
+	uint64_t start = sim_time_ns();
+	int32_t ret = SUCCESS;
+	uint32_t i;
+
+	dev = sim_axi_io_get(base, offset, count);
+	if (!dev)
+		return FAILURE;
+
+	for (i = 0; (i < count) && (ret == SUCCESS); i++)
+		ret = sim_axi_io_reg_read(dev, offset + i * 4, &data[i]);
+
+	stats->axi_blocks++;
+	stats->axi_block_words += count;
+	stats->axi_bus_ns += (uint64_t)count * SIM_AXI_IO_ACCESS_NS;
+	stats->axi_host_ns += sim_time_ns() - start;
+
+	return ret;
+}
+
+/**
+ * @brief AXI IO block write to a modeled device.
+ * @param base - Base address.
+ * @param offset - Address offset.
+ * @param data - Data to be written.
+ * @param count - Number of 32-bit words to be written.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_write_block(uint32_t base, uint32_t offset,
+			   const uint32_t *data, uint32_t count)
+{
+	struct sim_stats *stats = sim_stats_get();
+	struct sim_axi_io_dev *dev;
+	uint64_t start = sim_time_ns();
+	int32_t ret = SUCCESS;
+	uint32_t i;
+
+	dev = sim_axi_io_get(base, offset, count);
+	if (!dev)
+		return FAILURE;
+
+	for (i = 0; (i < count) && (ret == SUCCESS); i++)
+		ret = sim_axi_io_reg_write(dev, offset + i * 4, data[i]);
+
+	stats->axi_blocks++;
+	stats->axi_block_words += count;
+	stats->axi_bus_ns += (uint64_t)count * SIM_AXI_IO_ACCESS_NS;
+	stats->axi_host_ns += sim_time_ns() - start;
+
+	return ret;
+}
@@ -0,0 +1,87 @@
+/***************************************************************************//**
+ *   @file   sim/axi_io_extra.h
+ *   @brief  Header file of the host simulation AXI IO register models.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef AXI_IO_EXTRA_H_
+#define AXI_IO_EXTRA_H_
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+/* Number of AXI devices that can be modeled at the same time. */
+#define SIM_AXI_IO_MAX_DEVICES	16
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @struct sim_axi_io_ops
+ * @brief Behaviour of a modeled AXI device. Both callbacks are optional, the
+ * register file behaves as plain memory when a callback is not set.
+ */
+struct sim_axi_io_ops {
+	/** Read a register: fill data, e.g. from regs[offset / 4] */
+	int32_t (*read)(void *ctx, uint32_t *regs, uint32_t offset,
+			uint32_t *data);
+	/** Write a register: update regs and apply the side effects */
+	int32_t (*write)(void *ctx, uint32_t *regs, uint32_t offset,
+			 uint32_t data);
+};
+
+/******************************************************************************/
+/************************ Functions Declarations ******************************/
+/******************************************************************************/
+
+/* Add a modeled AXI device at the specified base address. */
+int32_t sim_axi_io_add(uint32_t base, uint32_t size,
+		       const struct sim_axi_io_ops *ops, void *ctx);
+
+/* Remove a modeled AXI device. */
+int32_t sim_axi_io_remove(uint32_t base);
+
+/* Get the register file of a modeled AXI device. */
+uint32_t *sim_axi_io_regs(uint32_t base);
+
+#endif // AXI_IO_EXTRA_H_
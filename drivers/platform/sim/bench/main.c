@@ -0,0 +1,262 @@
+/***************************************************************************//**
+ *   @file   sim/bench/main.c
+ *   @brief  Benchmarks of drivers running on the host simulation platform.
+ *   @brief  Implementation of host simulation delays.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include "error.h"
+#include "spi.h"
+#include "spi_extra.h"
+#include "axi_dmac.h"
+#include "axi_io_extra.h"
+#include "sim_axi_dmac.h"
+#include "sim_stats.h"
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+#define BENCH_ITERATIONS	1000
+
+#define BENCH_DMAC_BASEADDR	0x7C400000
+#define BENCH_DMAC_LATENCY	8
+#define BENCH_DMAC_ADDRESS	0x00800000
+#define BENCH_DMAC_SIZE		0x4000
+#define BENCH_DMAC_BUFFERS	8
+#define BENCH_DMAC_STREAM_GETS	64
+#define BENCH_DMAC_TIMEOUT_MS	1000
+
+#define BENCH_SPI_REGS		0x400
+#define BENCH_SPI_SPEED_HZ	10000000
+#define BENCH_SPI_BURST		16
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief One blocking single shot transfer.
+ * @param ctx - The DMAC.
+ * @return SUCCESS in case of success, negative error code otherwise.
+ */
+static int32_t bench_dmac_transfer(void *ctx)
+{
+	struct axi_dmac *dmac = ctx;
+
+	return axi_dmac_transfer(dmac, BENCH_DMAC_ADDRESS, BENCH_DMAC_SIZE);
+}
+
+/**
+ * @brief Start a capture ring, consume BENCH_DMAC_STREAM_GETS buffers and
+ * stop it.
+ * @param ctx - The DMAC.
+ * @return SUCCESS in case of success, negative error code otherwise.
+ */
+static int32_t bench_dmac_stream(void *ctx)
+{
+	struct axi_dmac *dmac = ctx;
+	struct axi_dmac_stream_init init = {
+		.address = BENCH_DMAC_ADDRESS,
+		.size = BENCH_DMAC_SIZE,
+		.num_buffers = BENCH_DMAC_BUFFERS,
+	};
+	struct axi_dmac_stream *stream;
+	struct axi_dmac_stream_buf *buf;
+	uint32_t i;
+	int32_t ret;
+
+	ret = axi_dmac_stream_init(&stream, dmac, &init);
+	if (ret != SUCCESS)
+		return ret;
+
+	ret = axi_dmac_stream_start(stream);
+	for (i = 0; (i < BENCH_DMAC_STREAM_GETS) && (ret == SUCCESS); i++) {
+		ret = axi_dmac_stream_get(stream, &buf, BENCH_DMAC_TIMEOUT_MS);
+		if (ret != SUCCESS)
+			break;
+		/* The buffers are handed over in capture order, without gaps. */
+		if ((buf->seq != i) || buf->gap)
+			ret = FAILURE;
+		else
+			ret = axi_dmac_stream_release(stream, buf);
+	}
+
+	axi_dmac_stream_remove(stream);
+
+	return ret;
+}
+
+/**
+ * @brief Run the AXI DMAC benchmarks against the DMAC model.
+ * @return SUCCESS in case of success, negative error code otherwise.
+ */
+static int32_t bench_dmac(void)
+{
+	struct sim_axi_dmac model = {
+		.latency = BENCH_DMAC_LATENCY,
+		.hw_2d = 1,
+	};
+	struct axi_dmac_init init = {
+		.name = "rx_dmac",
+		.base = BENCH_DMAC_BASEADDR,
+		.direction = DMA_DEV_TO_MEM,
+		.flags = 0,
+		.irq_en = false,
+	};
+	struct axi_dmac *dmac;
+	int32_t ret;
+
+	ret = sim_axi_dmac_add(BENCH_DMAC_BASEADDR, &model);
+	if (ret != SUCCESS)
+		return ret;
+
+	ret = axi_dmac_init(&dmac, &init);
+	if (ret != SUCCESS)
+		goto error_model;
+
+	ret = sim_bench("axi_dmac transfer", bench_dmac_transfer, dmac,
+			BENCH_ITERATIONS);
+	if (ret != SUCCESS)
+		goto error_dmac;
+
+	ret = sim_bench("axi_dmac stream", bench_dmac_stream, dmac,
+			BENCH_ITERATIONS);
+
+error_dmac:
+	axi_dmac_remove(dmac);
+error_model:
+	sim_axi_io_remove(BENCH_DMAC_BASEADDR);
+	printf("  model: %"PRIu32" transfers, %"PRIu64" bytes\n",
+	       model.transfers, model.bytes);
+
+	return ret;
+}
+
+/**
+ * @brief Write BENCH_SPI_BURST registers one by one with 16-bit instructions
+ * and read them back.
+ * @param ctx - The SPI descriptor.
+ * @return SUCCESS in case of success, negative error code otherwise.
+ */
+static int32_t bench_spi_regmap(void *ctx)
+{
+	struct spi_desc *spi = ctx;
+	uint8_t buf[3];
+	uint16_t reg;
+	int32_t ret;
+
+	for (reg = 0; reg < BENCH_SPI_BURST; reg++) {
+		buf[0] = 0x80 | ((reg >> 8) & 0x03);
+		buf[1] = reg & 0xFF;
+		buf[2] = reg ^ 0x5A;
+		ret = spi_write_and_read(spi, buf, 3);
+		if (ret != SUCCESS)
+			return ret;
+	}
+
+	for (reg = 0; reg < BENCH_SPI_BURST; reg++) {
+		buf[0] = (reg >> 8) & 0x03;
+		buf[1] = reg & 0xFF;
+		buf[2] = 0;
+		ret = spi_write_and_read(spi, buf, 3);
+		if (ret != SUCCESS)
+			return ret;
+		if (buf[2] != (uint8_t)(reg ^ 0x5A))
+			return FAILURE;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Run the SPI benchmark against a register map with the AD9361
+ * instruction format: R/W in bit 15 (high for a write), address in bits 9:0.
+ * @return SUCCESS in case of success, negative error code otherwise.
+ */
+static int32_t bench_spi(void)
+{
+	static uint8_t regs[BENCH_SPI_REGS];
+	struct sim_spi_regmap map = {
+		.regs = regs,
+		.size = BENCH_SPI_REGS,
+		.rw_mask = 0x8000,
+		.read_high = 0,
+		.addr_mask = 0x3FF,
+		.addr_descending = 1,
+	};
+	sim_spi_init_param sim_init = {
+		.xfer = sim_spi_regmap_xfer,
+		.ctx = &map,
+	};
+	struct spi_init_param init = {
+		.max_speed_hz = BENCH_SPI_SPEED_HZ,
+		.chip_select = 0,
+		.mode = SPI_MODE_1,
+		.extra = &sim_init,
+	};
+	struct spi_desc *spi;
+	int32_t ret;
+
+	ret = spi_init(&spi, &init);
+	if (ret != SUCCESS)
+		return ret;
+
+	ret = sim_bench("spi regmap", bench_spi_regmap, spi, BENCH_ITERATIONS);
+
+	spi_remove(spi);
+
+	return ret;
+}
+
+/**
+ * @brief Run the benchmarks of the simulated platform.
+ * @return 0 when all of them passed, 1 otherwise.
+ */
+int main(void)
+{
+	int32_t ret;
+
+	ret = bench_dmac();
+	ret |= bench_spi();
+
+	return (ret == SUCCESS) ? 0 : 1;
+}
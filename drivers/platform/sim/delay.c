@@ -1,9 +1,8 @@
 /***************************************************************************//**
- *   @file   fifo.c
- *   @brief  Implementation of fifo.
- *   @author Cristian Pop (cristian.pop@analog.com)
+ *   @file   sim/delay.c
+ *   @brief  Implementation of host simulation delays.
 ********************************************************************************
- * Copyright 2019(c) Analog Devices, Inc.
+ * Copyright 2020(c) Analog Devices, Inc.
  *
  * All rights reserved.
  *
@@ -41,96 +40,37 @@
 /***************************** Include Files **********************************/
 /******************************************************************************/
 
-#include <string.h>
-#include <stdlib.h>
-#include "fifo.h"
-#include "error.h"
+#include "delay.h"
+#include "sim_stats.h"
 
 /******************************************************************************/
 /************************ Functions Definitions *******************************/
 /******************************************************************************/
 
 /**
- * @brief Create new fifo element
- * @param buff - Data to be saved in fifo.
- * @param len - Length of the data.
- * @return fifo element in case of success, NULL otherwise
+ * @brief Generate microseconds delay. The delay is only accounted, the
+ * modeled devices settle immediately.
+ * @param usecs - Delay in microseconds.
+ * @return None.
  */
-static struct fifo_element * fifo_new_element(char *buff, uint32_t len)
+void udelay(uint32_t usecs)
 {
-	struct fifo_element *q = calloc(1, sizeof(struct fifo_element));
-	if (!q)
-		return NULL;
+	struct sim_stats *stats = sim_stats_get();
 
-	q->len = len;
-	q->data = calloc(1, len);
-	if (!(q->data)) {
-		free(q);
-		return NULL;
-	}
-	memcpy(q->data, buff, len);
-
-	return q;
+	stats->delays++;
+	stats->delay_ns += (uint64_t)usecs * 1000;
 }
 
 /**
- * @brief Get last element in fifo
- * @param p_fifo - pointer to fifo
- * @return fifo last element if exists, NULL otherwise
+ * @brief Generate miliseconds delay. The delay is only accounted, the
+ * modeled devices settle immediately.
+ * @param msecs - Delay in miliseconds.
+ * @return None.
  */
-static struct fifo_element *fifo_get_last(struct fifo_element *p_fifo)
+void mdelay(uint32_t msecs)
 {
-	if(p_fifo == NULL)
-		return NULL;
-	while (p_fifo->next) {
-		p_fifo = p_fifo->next;
-	}
-
-	return p_fifo;
-}
-
-/**
- * @brief Insert element to fifo, in the last position.
- * @param pfifo - Pointer to fifo.
- * @param buff - Data to be saved in fifo.
- * @param len - Length of the data.
- * @return SUCCESS in case of success, FAILURE otherwise
- */
-int32_t fifo_insert(struct fifo_element **p_fifo, char *buff, uint32_t len)
-{
-	struct fifo_element *p, *q;
-
-	if (len <= 0)
-		return FAILURE;
-
-	q = fifo_new_element(buff, len);
-	if (!q)
-		return FAILURE;
-
-	if (!(*p_fifo)) {
-		*p_fifo = q;
-	} else {
-		p = fifo_get_last(*p_fifo);
-		p->next = q;
-	}
-
-	return SUCCESS;
-}
-
-/**
- * @brief Remove fifo head
- * @param pfifo - Pointer to fifo.
- * @return next element in fifo if exists, NULL otherwise.
- */
-struct fifo_element * fifo_remove(struct fifo_element *p_fifo)
-{
-	struct fifo_element *p = p_fifo;
-
-	if (p_fifo != NULL) {
-		p_fifo = p_fifo->next;
-		free(p->data);
-		free(p);
-	}
+	struct sim_stats *stats = sim_stats_get();
 
-	return p_fifo;
+	stats->delays++;
+	stats->delay_ns += (uint64_t)msecs * 1000000;
 }
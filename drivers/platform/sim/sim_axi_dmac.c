@@ -0,0 +1,195 @@
+/***************************************************************************//**
+ *   @file   sim/sim_axi_dmac.c
+ *   @brief  Implementation of the host simulation AXI DMAC model.
+ *   @brief  Implementation of host simulation delays.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <string.h>
+#include "error.h"
+#include "axi_io_extra.h"
+#include "sim_axi_dmac.h"
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Retire the oldest queued transfer.
+ * @param dmac - The model.
+ * @param regs - The register file.
+ * @return None.
+ */
+static void sim_axi_dmac_complete(struct sim_axi_dmac *dmac, uint32_t *regs)
+{
+	uint32_t id = dmac->head;
+
+	dmac->queued &= ~BIT(id);
+	dmac->head = (id + 1) % AXI_DMAC_MAX_TRANSFERS;
+	dmac->transfers++;
+	dmac->bytes += dmac->size[id];
+
+	regs[AXI_DMAC_REG_TRANSFER_DONE / 4] |= BIT(id);
+	regs[AXI_DMAC_REG_IRQ_PENDING / 4] |= AXI_DMAC_IRQ_EOT;
+}
+
+/**
+ * @brief Queue the transfer programmed in the registers.
+ * @param dmac - The model.
+ * @param regs - The register file.
+ * @return None.
+ */
+static void sim_axi_dmac_start(struct sim_axi_dmac *dmac, uint32_t *regs)
+{
+	uint32_t id = regs[AXI_DMAC_REG_TRANSFER_ID / 4] %
+		      AXI_DMAC_MAX_TRANSFERS;
+	uint32_t y_length = 1;
+
+	if (!(regs[AXI_DMAC_REG_CTRL / 4] & AXI_DMAC_CTRL_ENABLE) ||
+	    (dmac->queued & BIT(id)))
+		return;
+
+	if (dmac->hw_2d)
+		y_length = regs[AXI_DMAC_REG_Y_LENGTH / 4] + 1;
+
+	if (!dmac->queued)
+		dmac->head = id;
+	dmac->queued |= BIT(id);
+	dmac->remaining[id] = dmac->latency;
+	dmac->size[id] = (regs[AXI_DMAC_REG_X_LENGTH / 4] + 1) * y_length;
+
+	regs[AXI_DMAC_REG_TRANSFER_DONE / 4] &= ~BIT(id);
+	regs[AXI_DMAC_REG_TRANSFER_ID / 4] = (id + 1) % AXI_DMAC_MAX_TRANSFERS;
+	regs[AXI_DMAC_REG_IRQ_PENDING / 4] |= AXI_DMAC_IRQ_SOT;
+}
+
+/**
+ * @brief Register read callback.
+ * @param ctx - The model, struct sim_axi_dmac.
+ * @param regs - The register file.
+ * @param offset - Address offset.
+ * @param data - Location where read data will be stored.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+static int32_t sim_axi_dmac_read(void *ctx, uint32_t *regs, uint32_t offset,
+				 uint32_t *data)
+{
+	struct sim_axi_dmac *dmac = ctx;
+
+	/* Every completion poll lets the oldest transfer progress. */
+	if ((offset == AXI_DMAC_REG_TRANSFER_DONE) &&
+	    (dmac->queued & BIT(dmac->head))) {
+		if (dmac->remaining[dmac->head])
+			dmac->remaining[dmac->head]--;
+		if (!dmac->remaining[dmac->head])
+			sim_axi_dmac_complete(dmac, regs);
+	}
+
+	*data = regs[offset / 4];
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Register write callback.
+ * @param ctx - The model, struct sim_axi_dmac.
+ * @param regs - The register file.
+ * @param offset - Address offset.
+ * @param data - Data to be written.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+static int32_t sim_axi_dmac_write(void *ctx, uint32_t *regs, uint32_t offset,
+				  uint32_t data)
+{
+	struct sim_axi_dmac *dmac = ctx;
+
+	switch (offset) {
+	case AXI_DMAC_REG_IRQ_PENDING:
+		/* Write one to clear */
+		regs[offset / 4] &= ~data;
+		break;
+	case AXI_DMAC_REG_CTRL:
+		regs[offset / 4] = data;
+		/* Disabling the core aborts the queued transfers */
+		if (!(data & AXI_DMAC_CTRL_ENABLE))
+			dmac->queued = 0;
+		break;
+	case AXI_DMAC_REG_START_TRANSFER:
+		/* The queue is always accepting, the register reads back 0 */
+		if (data & 0x1)
+			sim_axi_dmac_start(dmac, regs);
+		break;
+	case AXI_DMAC_REG_Y_LENGTH:
+		regs[offset / 4] = dmac->hw_2d ? data : 0;
+		break;
+	case AXI_DMAC_REG_TRANSFER_ID:
+	case AXI_DMAC_REG_TRANSFER_DONE:
+		/* Read only */
+		break;
+	default:
+		regs[offset / 4] = data;
+		break;
+	}
+
+	return SUCCESS;
+}
+
+static const struct sim_axi_io_ops sim_axi_dmac_ops = {
+	.read = sim_axi_dmac_read,
+	.write = sim_axi_dmac_write,
+};
+
+/**
+ * @brief Add an AXI DMAC model at the specified base address. The statistics
+ * and the state of the model are cleared, latency and hw_2d are kept.
+ * @param base - Base address, as set in struct axi_dmac_init.
+ * @param dmac - The model.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t sim_axi_dmac_add(uint32_t base, struct sim_axi_dmac *dmac)
+{
+	dmac->transfers = 0;
+	dmac->bytes = 0;
+	dmac->queued = 0;
+	dmac->head = 0;
+	memset(dmac->remaining, 0, sizeof(dmac->remaining));
+	memset(dmac->size, 0, sizeof(dmac->size));
+
+	return sim_axi_io_add(base, SIM_AXI_DMAC_REGS_SIZE, &sim_axi_dmac_ops,
+			      dmac);
+}
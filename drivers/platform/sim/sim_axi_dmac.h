@@ -0,0 +1,94 @@
+/***************************************************************************//**
+ *   @file   sim/sim_axi_dmac.h
+ *   @brief  Header file of the host simulation AXI DMAC model.
+ *   @brief  Implementation of host simulation delays.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef SIM_AXI_DMAC_H_
+#define SIM_AXI_DMAC_H_
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <stdint.h>
+#include "axi_dmac.h"
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+/* Size of the register space of the AXI DMAC. */
+#define SIM_AXI_DMAC_REGS_SIZE	0x800
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @struct sim_axi_dmac
+ * @brief AXI DMAC model. Queued transfers complete in order, each one after
+ * "latency" reads of TRANSFER_DONE, so the polled completion path of the
+ * driver is exercised. No data is moved and the interrupt is not raised,
+ * the driver must be used with irq_en cleared.
+ */
+struct sim_axi_dmac {
+	/** TRANSFER_DONE reads taken by a transfer to complete */
+	uint32_t	latency;
+	/** Y_LENGTH is writable, the core supports 2D transfers */
+	uint8_t		hw_2d;
+	/** Transfers completed */
+	uint32_t	transfers;
+	/** Bytes of the completed transfers */
+	uint64_t	bytes;
+	/** Model state: queued transfer IDs */
+	uint32_t	queued;
+	/** Model state: ID of the oldest queued transfer */
+	uint32_t	head;
+	/** Model state: TRANSFER_DONE reads left for each transfer */
+	uint32_t	remaining[AXI_DMAC_MAX_TRANSFERS];
+	/** Model state: size of each queued transfer in bytes */
+	uint32_t	size[AXI_DMAC_MAX_TRANSFERS];
+};
+
+/******************************************************************************/
+/************************ Functions Declarations ******************************/
+/******************************************************************************/
+
+/* Add an AXI DMAC model at the specified base address. */
+int32_t sim_axi_dmac_add(uint32_t base, struct sim_axi_dmac *dmac);
+
+#endif // SIM_AXI_DMAC_H_
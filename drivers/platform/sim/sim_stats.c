@@ -0,0 +1,169 @@
+/***************************************************************************//**
+ *   @file   sim/sim_stats.c
+ *   @brief  Host simulation transaction statistics and benchmark harness.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "error.h"
+#include "sim_stats.h"
+
+/******************************************************************************/
+/************************ Variables Definitions *******************************/
+/******************************************************************************/
+
+static struct sim_stats sim_stats;
+
+/* Modeled target time accounted before the last sim_stats_reset() */
+static uint64_t sim_target_base_ns;
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Get the counters of the simulated platform.
+ * @return The counters, updated by every platform call.
+ */
+struct sim_stats *sim_stats_get(void)
+{
+	return &sim_stats;
+}
+
+/**
+ * @brief Clear the counters of the simulated platform.
+ * @return None.
+ */
+void sim_stats_reset(void)
+{
+	sim_target_base_ns = sim_target_ns();
+	memset(&sim_stats, 0, sizeof(sim_stats));
+}
+
+/**
+ * @brief Print the counters of the simulated platform.
+ * @param name - Label of the report.
+ * @return None.
+ */
+void sim_stats_print(const char *name)
+{
+	struct sim_stats *s = &sim_stats;
+
+	printf("%s:\n", name);
+	printf("  axi: %"PRIu64" rd, %"PRIu64" wr, %"PRIu64" blocks (%"PRIu64
+	       " words), host %"PRIu64" ns, bus %"PRIu64" ns\n",
+	       s->axi_reads, s->axi_writes, s->axi_blocks, s->axi_block_words,
+	       s->axi_host_ns, s->axi_bus_ns);
+	printf("  spi: %"PRIu64" xfers, %"PRIu64" segments, %"PRIu64
+	       " bytes, host %"PRIu64" ns, bus %"PRIu64" ns\n",
+	       s->spi_xfers, s->spi_segments, s->spi_bytes,
+	       s->spi_host_ns, s->spi_bus_ns);
+	printf("  delay: %"PRIu64" calls, %"PRIu64" ns\n",
+	       s->delays, s->delay_ns);
+	printf("  target estimate: %"PRIu64" ns\n",
+	       s->axi_bus_ns + s->spi_bus_ns + s->delay_ns);
+}
+
+/**
+ * @brief Get the modeled target time: the AXI and SPI bus times and the
+ * delays accounted since the start, not cleared by sim_stats_reset().
+ * @return The time in nanoseconds.
+ */
+uint64_t sim_target_ns(void)
+{
+	struct sim_stats *s = &sim_stats;
+
+	return sim_target_base_ns + s->axi_bus_ns + s->spi_bus_ns + s->delay_ns;
+}
+
+/**
+ * @brief Get the host monotonic time.
+ * @return The time in nanoseconds.
+ */
+uint64_t sim_time_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * @brief Run a function several times and report its transactions and
+ * latency. The counters are reset before the first run and hold the totals
+ * of all the runs on return.
+ * @param name - Label of the report.
+ * @param fn - The function to be measured, e.g. a driver init sequence.
+ * @param ctx - Argument of the function.
+ * @param iterations - Number of runs.
+ * @return SUCCESS in case of success, the error of the function otherwise.
+ */
+int32_t sim_bench(const char *name,
+		  int32_t (*fn)(void *ctx),
+		  void *ctx,
+		  uint32_t iterations)
+{
+	uint64_t start, elapsed;
+	uint32_t i;
+	int32_t ret = SUCCESS;
+
+	if (!fn || !iterations)
+		return FAILURE;
+
+	sim_stats_reset();
+
+	start = sim_time_ns();
+	for (i = 0; i < iterations; i++) {
+		ret = fn(ctx);
+		if (ret < 0)
+			break;
+	}
+	elapsed = sim_time_ns() - start;
+
+	sim_stats_print(name);
+	printf("  runs: %"PRIu32", host %"PRIu64" ns/run\n",
+	       i, i ? elapsed / i : elapsed);
+	if (ret < 0)
+		printf("  run %"PRIu32" failed: %"PRId32"\n", i, ret);
+
+	return ret;
+}
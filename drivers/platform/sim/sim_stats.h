@@ -0,0 +1,126 @@
+/***************************************************************************//**
+ *   @file   sim/sim_stats.h
+ *   @brief  Header file of the host simulation transaction statistics.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef SIM_STATS_H_
+#define SIM_STATS_H_
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+/* Modeled duration of one AXI register access, in nanoseconds. */
+#ifndef SIM_AXI_IO_ACCESS_NS
+#define SIM_AXI_IO_ACCESS_NS	100
+#endif
+
+/* Modeled overhead of one SPI transaction (CS setup/hold), in nanoseconds. */
+#ifndef SIM_SPI_XFER_OVERHEAD_NS
+#define SIM_SPI_XFER_OVERHEAD_NS	1000
+#endif
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @struct sim_stats
+ * @brief Transactions issued through the simulated platform. Host times are
+ * the time spent in the platform calls (including the device models), bus
+ * times are the modeled durations on the target.
+ */
+struct sim_stats {
+	/** AXI single register reads */
+	uint64_t	axi_reads;
+	/** AXI single register writes */
+	uint64_t	axi_writes;
+	/** AXI block transfers */
+	uint64_t	axi_blocks;
+	/** 32-bit words moved by the AXI block transfers */
+	uint64_t	axi_block_words;
+	/** SPI transactions (spi_write_and_read() or spi_transfer_msgs()) */
+	uint64_t	spi_xfers;
+	/** SPI message segments */
+	uint64_t	spi_segments;
+	/** SPI bytes */
+	uint64_t	spi_bytes;
+	/** Calls to udelay()/mdelay() */
+	uint64_t	delays;
+	/** Host time spent in AXI accesses */
+	uint64_t	axi_host_ns;
+	/** Host time spent in SPI transactions */
+	uint64_t	spi_host_ns;
+	/** Modeled AXI bus time */
+	uint64_t	axi_bus_ns;
+	/** Modeled SPI bus time */
+	uint64_t	spi_bus_ns;
+	/** Requested delays, not slept on the host */
+	uint64_t	delay_ns;
+};
+
+/******************************************************************************/
+/************************ Functions Declarations ******************************/
+/******************************************************************************/
+
+/* Get the counters of the simulated platform. */
+struct sim_stats *sim_stats_get(void);
+
+/* Clear the counters of the simulated platform. */
+void sim_stats_reset(void);
+
+/* Print the counters of the simulated platform. */
+void sim_stats_print(const char *name);
+
+/* Get the modeled target time, in nanoseconds. */
+uint64_t sim_target_ns(void);
+
+/* Get the host monotonic time, in nanoseconds. */
+uint64_t sim_time_ns(void);
+
+/* Run a function several times and report its transactions and latency. */
+int32_t sim_bench(const char *name,
+		  int32_t (*fn)(void *ctx),
+		  void *ctx,
+		  uint32_t iterations);
+
+#endif // SIM_STATS_H_
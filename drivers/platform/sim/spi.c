@@ -0,0 +1,233 @@
+/***************************************************************************//**
+ *   @file   sim/spi.c
+ *   @brief  Implementation of host simulation SPI device models.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+#include <stdlib.h>
+#include "error.h"
+#include "spi.h"
+#include "spi_extra.h"
+#include "sim_stats.h"
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Register map model callback.
+ * @param ctx - The register map, struct sim_spi_regmap.
+ * @param tx - Written data, NULL when zeros are written.
+ * @param rx - Buffer for the read data, NULL when it is discarded.
+ * @param bytes_number - Number of bytes of the segment.
+ * @param cs_release - The chip select is deasserted after the segment.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t sim_spi_regmap_xfer(void *ctx, const uint8_t *tx, uint8_t *rx,
+			    uint32_t bytes_number, uint8_t cs_release)
+{
+	struct sim_spi_regmap *map = ctx;
+	uint8_t in, out;
+	uint8_t read;
+	uint32_t i;
+
+	for (i = 0; i < bytes_number; i++) {
+		in = tx ? tx[i] : 0;
+		out = 0;
+
+		if (map->frame_bytes < 2) {
+			map->instr = (map->instr << 8) | in;
+			if (map->frame_bytes == 1)
+				map->addr = map->instr & map->addr_mask;
+		} else {
+			read = (map->instr & map->rw_mask) ? map->read_high :
+			       !map->read_high;
+			if (map->addr < map->size) {
+				if (read)
+					out = map->regs[map->addr];
+				else
+					map->regs[map->addr] = in;
+			}
+			if (map->addr_descending)
+				map->addr--;
+			else
+				map->addr++;
+		}
+		map->frame_bytes++;
+
+		if (rx)
+			rx[i] = out;
+	}
+
+	if (cs_release) {
+		map->frame_bytes = 0;
+		map->instr = 0;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Account a SPI transaction in the statistics.
+ * @param desc - The SPI descriptor.
+ * @param segments - Number of segments.
+ * @param bytes_number - Number of bytes.
+ * @param start - Host time of the start of the transaction.
+ * @return None.
+ */
+static void sim_spi_account(struct spi_desc *desc, uint32_t segments,
+			    uint32_t bytes_number, uint64_t start)
+{
+	struct sim_stats *stats = sim_stats_get();
+
+	stats->spi_xfers++;
+	stats->spi_segments += segments;
+	stats->spi_bytes += bytes_number;
+	stats->spi_bus_ns += SIM_SPI_XFER_OVERHEAD_NS;
+	if (desc->max_speed_hz)
+		stats->spi_bus_ns += (uint64_t)bytes_number * 8 * 1000000000ull /
+				     desc->max_speed_hz;
+	stats->spi_host_ns += sim_time_ns() - start;
+}
+
+/**
+ * @brief Initialize the SPI communication peripheral.
+ * @param desc - The SPI descriptor.
+ * @param param - The structure that contains the SPI parameters, "extra"
+ *                is a struct sim_spi_init_param.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t spi_init(struct spi_desc **desc,
+		 const struct spi_init_param *param)
+{
+	sim_spi_init_param *sim_init;
+	sim_spi_desc *sim_desc;
+	spi_desc *descriptor;
+
+	sim_init = param->extra;
+	if (!sim_init || !sim_init->xfer)
+		return FAILURE;
+
+	descriptor = (spi_desc *)malloc(sizeof(*descriptor));
+	if (!descriptor)
+		return FAILURE;
+
+	sim_desc = (sim_spi_desc *)malloc(sizeof(*sim_desc));
+	if (!sim_desc) {
+		free(descriptor);
+		return FAILURE;
+	}
+
+	sim_desc->xfer = sim_init->xfer;
+	sim_desc->ctx = sim_init->ctx;
+
+	descriptor->max_speed_hz = param->max_speed_hz;
+	descriptor->chip_select = param->chip_select;
+	descriptor->mode = param->mode;
+	descriptor->extra = sim_desc;
+
+	*desc = descriptor;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Free the resources allocated by spi_init().
+ * @param desc - The SPI descriptor.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t spi_remove(struct spi_desc *desc)
+{
+	free(desc->extra);
+	free(desc);
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Write and read data to/from SPI.
+ * @param desc - The SPI descriptor.
+ * @param data - The buffer with the transmitted/received data.
+ * @param bytes_number - Number of bytes to write/read.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t spi_write_and_read(struct spi_desc *desc,
+			   uint8_t *data,
+			   uint16_t bytes_number)
+{
+	sim_spi_desc *sim_desc = desc->extra;
+	uint64_t start = sim_time_ns();
+	int32_t ret;
+
+	ret = sim_desc->xfer(sim_desc->ctx, data, data, bytes_number, 1);
+
+	sim_spi_account(desc, 1, bytes_number, start);
+
+	return ret;
+}
+
+/**
+ * @brief Transfer a message made of several segments.
+ * @param desc - The SPI descriptor.
+ * @param msgs - The segments of the message.
+ * @param msgs_number - Number of segments.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t spi_transfer_msgs(struct spi_desc *desc,
+			  struct spi_msg *msgs,
+			  uint32_t msgs_number)
+{
+	sim_spi_desc *sim_desc = desc->extra;
+	uint64_t start = sim_time_ns();
+	uint32_t bytes_number = 0;
+	uint32_t i;
+	int32_t ret = SUCCESS;
+
+	for (i = 0; (i < msgs_number) && (ret == SUCCESS); i++) {
+		/* the chip select is always released at the end of a message */
+		ret = sim_desc->xfer(sim_desc->ctx, msgs[i].tx_buff,
+				     msgs[i].rx_buff, msgs[i].bytes_number,
+				     (i == msgs_number - 1) || msgs[i].cs_change);
+		bytes_number += msgs[i].bytes_number;
+		sim_stats_get()->delay_ns += (uint64_t)msgs[i].delay_usecs * 1000;
+	}
+
+	sim_spi_account(desc, msgs_number, bytes_number, start);
+
+	return ret;
+}
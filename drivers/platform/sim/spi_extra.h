@@ -0,0 +1,122 @@
+/***************************************************************************//**
+ *   @file   sim/spi_extra.h
+ *   @brief  Header file of the host simulation SPI device models.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef SPI_EXTRA_H_
+#define SPI_EXTRA_H_
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Behaviour of a modeled SPI device, called for every segment.
+ * @param ctx - Argument of the callback.
+ * @param tx - Written data, NULL when zeros are written.
+ * @param rx - Buffer for the read data, NULL when it is discarded. It may
+ *             alias tx.
+ * @param bytes_number - Number of bytes of the segment.
+ * @param cs_release - The chip select is deasserted after the segment.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+typedef int32_t (*sim_spi_xfer_cb)(void *ctx, const uint8_t *tx, uint8_t *rx,
+				   uint32_t bytes_number, uint8_t cs_release);
+
+/**
+ * @struct sim_spi_init_param
+ * @brief Simulation specific SPI parameters, the "extra" of spi_init_param.
+ */
+typedef struct sim_spi_init_param {
+	/** Behaviour of the device */
+	sim_spi_xfer_cb	xfer;
+	/** Argument of the callback, e.g. a struct sim_spi_regmap */
+	void		*ctx;
+} sim_spi_init_param;
+
+/**
+ * @struct sim_spi_desc
+ * @brief Simulation specific SPI descriptor.
+ */
+typedef struct sim_spi_desc {
+	/** Behaviour of the device */
+	sim_spi_xfer_cb	xfer;
+	/** Argument of the callback */
+	void		*ctx;
+} sim_spi_desc;
+
+/**
+ * @struct sim_spi_regmap
+ * @brief Register map model for the ADI 16-bit instruction SPI protocol:
+ * a R/W bit and the address, followed by the data bytes of consecutive
+ * registers, for as long as the chip select is asserted.
+ */
+struct sim_spi_regmap {
+	/** Register file, one byte per register */
+	uint8_t		*regs;
+	/** Number of registers */
+	uint32_t	size;
+	/** Instruction bit selecting the direction */
+	uint16_t	rw_mask;
+	/** The access is a read when the R/W bit is set (else when cleared) */
+	uint8_t		read_high;
+	/** Instruction bits holding the address */
+	uint16_t	addr_mask;
+	/** Consecutive data bytes go to decreasing addresses */
+	uint8_t		addr_descending;
+	/** Frame state: bytes received since the chip select was asserted */
+	uint32_t	frame_bytes;
+	/** Frame state: instruction of the frame */
+	uint16_t	instr;
+	/** Frame state: register of the next data byte */
+	uint32_t	addr;
+};
+
+/******************************************************************************/
+/************************ Functions Declarations ******************************/
+/******************************************************************************/
+
+/* Register map model callback, ctx is a struct sim_spi_regmap. */
+int32_t sim_spi_regmap_xfer(void *ctx, const uint8_t *tx, uint8_t *rx,
+			    uint32_t bytes_number, uint8_t cs_release);
+
+#endif // SPI_EXTRA_H_
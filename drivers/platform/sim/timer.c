@@ -0,0 +1,234 @@
+/***************************************************************************//**
+ *   @file   sim/timer.c
+ *   @brief  Implementation of host simulation timer.
+ *   @brief  Implementation of host simulation delays.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "error.h"
+#include "timer.h"
+#include "sim_stats.h"
+
+/******************************************************************************/
+/*************************** Types Declarations *******************************/
+/******************************************************************************/
+
+/**
+ * @struct sim_timer_desc
+ * @brief Simulation specific timer descriptor.
+ */
+struct sim_timer_desc {
+	/** Counter value when the timer was last started, set or stopped */
+	uint32_t	count;
+	/** Modeled target time of the last start or set */
+	uint64_t	start_ns;
+	/** The timer is counting */
+	bool		running;
+};
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Get the current counter value.
+ * @param desc - The timer descriptor.
+ * @return The counter value.
+ */
+static uint32_t sim_timer_count(struct timer_desc *desc)
+{
+	struct sim_timer_desc *sim_desc = desc->extra;
+	uint64_t ticks;
+
+	if (!sim_desc->running)
+		return sim_desc->count;
+
+	ticks = (sim_target_ns() - sim_desc->start_ns) * desc->freq_hz /
+		1000000000ull;
+
+	return sim_desc->count + (uint32_t)ticks;
+}
+
+/**
+ * @brief Initialize a timer counting the modeled target time (bus accesses
+ * and delays), so it can be the time source of poll_timeout().
+ * @param desc - The timer descriptor.
+ * @param param - The structure that contains the timer parameters.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_init(struct timer_desc **desc,
+		   struct timer_init_param *param)
+{
+	struct sim_timer_desc *sim_desc;
+	struct timer_desc *descriptor;
+
+	if (!param || !param->freq_hz)
+		return FAILURE;
+
+	descriptor = (struct timer_desc *)malloc(sizeof(*descriptor));
+	if (!descriptor)
+		return FAILURE;
+
+	sim_desc = (struct sim_timer_desc *)calloc(1, sizeof(*sim_desc));
+	if (!sim_desc) {
+		free(descriptor);
+		return FAILURE;
+	}
+
+	sim_desc->count = param->load_value;
+
+	descriptor->freq_hz = param->freq_hz;
+	descriptor->load_value = param->load_value;
+	descriptor->extra = sim_desc;
+
+	*desc = descriptor;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Free the resources allocated by timer_init().
+ * @param desc - The timer descriptor.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_remove(struct timer_desc *desc)
+{
+	if (!desc)
+		return FAILURE;
+
+	free(desc->extra);
+	free(desc);
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Start a timer.
+ * @param desc - The timer descriptor.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_start(struct timer_desc *desc)
+{
+	struct sim_timer_desc *sim_desc = desc->extra;
+
+	if (sim_desc->running)
+		return SUCCESS;
+
+	sim_desc->start_ns = sim_target_ns();
+	sim_desc->running = true;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Stop a timer from counting.
+ * @param desc - The timer descriptor.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_stop(struct timer_desc *desc)
+{
+	struct sim_timer_desc *sim_desc = desc->extra;
+
+	sim_desc->count = sim_timer_count(desc);
+	sim_desc->running = false;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Get the value of the counter register for the timer.
+ * @param desc - The timer descriptor.
+ * @param counter - The counter value.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_counter_get(struct timer_desc *desc, uint32_t *counter)
+{
+	*counter = sim_timer_count(desc);
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Set the timer counter register value.
+ * @param desc - The timer descriptor.
+ * @param new_val - The new counter value.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_counter_set(struct timer_desc *desc, uint32_t new_val)
+{
+	struct sim_timer_desc *sim_desc = desc->extra;
+
+	sim_desc->count = new_val;
+	sim_desc->start_ns = sim_target_ns();
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Get the timer clock frequency.
+ * @param desc - The timer descriptor.
+ * @param freq_hz - The frequency in Hz.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_count_clk_get(struct timer_desc *desc, uint32_t *freq_hz)
+{
+	*freq_hz = desc->freq_hz;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Set the timer clock frequency.
+ * @param desc - The timer descriptor.
+ * @param freq_hz - The frequency in Hz.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_count_clk_set(struct timer_desc *desc, uint32_t freq_hz)
+{
+	if (!freq_hz)
+		return FAILURE;
+
+	/* Keep counting from the current value at the new rate. */
+	timer_counter_set(desc, sim_timer_count(desc));
+	desc->freq_hz = freq_hz;
+
+	return SUCCESS;
+}
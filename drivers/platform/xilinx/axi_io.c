@@ -41,6 +41,7 @@
 /***************************** Include Files **********************************/
 /******************************************************************************/
 
+#include <string.h>
 #include <xil_io.h>
 #include "error.h"
 #include "axi_io.h"
@@ -77,3 +78,36 @@ int32_t axi_io_write(uint32_t base, uint32_t offset, uint32_t data)
 	return SUCCESS;
 }
 
+/**
+ * @brief AXI IO Xilinx specific block read function.
+ * @param base - Base address
+ * @param offset - Address offset
+ * @param data - buffer where the returned data is stored
+ * @param count - number of 32-bit words to be read
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_read_block(uint32_t base, uint32_t offset, uint32_t *data,
+			  uint32_t count)
+{
+	memcpy(data, (void *)(uintptr_t)(base + offset),
+	       count * sizeof(*data));
+
+	return SUCCESS;
+}
+
+/**
+ * @brief AXI IO Xilinx specific block write function.
+ * @param base - Base address
+ * @param offset - Address offset
+ * @param data - data to be written
+ * @param count - number of 32-bit words to be written
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t axi_io_write_block(uint32_t base, uint32_t offset,
+			   const uint32_t *data, uint32_t count)
+{
+	memcpy((void *)(uintptr_t)(base + offset), data,
+	       count * sizeof(*data));
+
+	return SUCCESS;
+}
@@ -42,6 +42,7 @@
 /******************************************************************************/
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <xparameters.h>
 #ifdef XPAR_XSPI_NUM_INSTANCES
@@ -52,6 +53,7 @@
 #endif
 
 #include "error.h"
+#include "delay.h"
 #include "spi.h"
 #include "spi_extra.h"
 
@@ -93,6 +95,8 @@ int32_t spi_init(struct spi_desc **desc,
 
 	xdesc->type = xinit->type;
 	xdesc->flags = xinit->flags;
+	xdesc->bounce = NULL;
+	xdesc->bounce_size = 0;
 	sdesc->extra = xdesc;
 
 	switch (xinit->type) {
@@ -256,6 +260,7 @@ error:
 		break;
 	}
 
+	free(xdesc->bounce);
 	free(xdesc->instance);
 	free(desc->extra);
 	free(desc);
@@ -347,3 +352,195 @@ error:
 
 	return SUCCESS;
 }
+
+#ifdef XSPIPS_H
+/**
+ * @brief Send the segments of one chip select frame of a message.
+ * XSpiPs_PolledTransfer() releases the slave select when it returns, so
+ * segments chained with "cs_change" cleared are gathered into a bounce buffer
+ * and sent with a single call.
+ * @param xdesc - The Xilinx SPI descriptor.
+ * @param msgs - The segments of the frame.
+ * @param msgs_number - Number of segments.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+static int32_t spi_ps_transfer_frame(struct xil_spi_desc *xdesc,
+				     struct spi_msg *msgs,
+				     uint32_t msgs_number)
+{
+	uint32_t	len = 0;
+	uint8_t		*buf;
+	uint8_t		*tx;
+	uint32_t	i;
+	int32_t		ret;
+
+	if (msgs_number == 1) {
+		tx = msgs[0].tx_buff;
+		if (!tx) {
+			/* the controller always shifts out, send zeros */
+			memset(msgs[0].rx_buff, 0, msgs[0].bytes_number);
+			tx = msgs[0].rx_buff;
+		}
+		return XSpiPs_PolledTransfer(xdesc->instance, tx,
+					     msgs[0].rx_buff,
+					     msgs[0].bytes_number);
+	}
+
+	for (i = 0; i < msgs_number; i++)
+		len += msgs[i].bytes_number;
+
+	if (len > xdesc->bounce_size) {
+		buf = (uint8_t *)realloc(xdesc->bounce, len);
+		if (!buf)
+			return FAILURE;
+		xdesc->bounce = buf;
+		xdesc->bounce_size = len;
+	}
+
+	buf = xdesc->bounce;
+	for (i = 0; i < msgs_number; i++) {
+		if (msgs[i].tx_buff)
+			memcpy(buf, msgs[i].tx_buff, msgs[i].bytes_number);
+		else
+			memset(buf, 0, msgs[i].bytes_number);
+		buf += msgs[i].bytes_number;
+	}
+
+	/* The received bytes never overtake the sent ones, so the transfer
+	 * can be done in place. */
+	ret = XSpiPs_PolledTransfer(xdesc->instance, xdesc->bounce,
+				    xdesc->bounce, len);
+	if (ret != SUCCESS)
+		return ret;
+
+	buf = xdesc->bounce;
+	for (i = 0; i < msgs_number; i++) {
+		if (msgs[i].rx_buff)
+			memcpy(msgs[i].rx_buff, buf, msgs[i].bytes_number);
+		buf += msgs[i].bytes_number;
+	}
+
+	return SUCCESS;
+}
+#endif
+
+/**
+ * @brief Transfer a message made of several segments. The controller is
+ * configured once per message and the chip select stays asserted across
+ * segments unless "cs_change" is set. On the PS SPI the segments of a chip
+ * select frame are sent as one transfer, their "delay_usecs" is ignored.
+ * @param desc - The SPI descriptor.
+ * @param msgs - The segments of the message.
+ * @param msgs_number - Number of segments.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t spi_transfer_msgs(struct spi_desc *desc,
+			  struct spi_msg *msgs,
+			  uint32_t msgs_number)
+{
+	int32_t			ret;
+	struct xil_spi_desc	*xdesc;
+	uint8_t			*tx;
+	uint32_t		i;
+#ifdef XSPIPS_H
+	uint32_t		j;
+#endif
+
+	xdesc = desc->extra;
+
+	switch (xdesc->type) {
+	case SPI_PL:
+#ifdef XSPI_H
+		ret = XSpi_SetOptions(xdesc->instance,
+				      XSP_MASTER_OPTION |
+				      XSP_MANUAL_SSELECT_OPTION |
+				      ((desc->mode & SPI_CPOL) ?
+				       XSP_CLK_ACTIVE_LOW_OPTION : 0) |
+				      ((desc->mode & SPI_CPHA) ?
+				       XSP_CLK_PHASE_1_OPTION : 0));
+		if (ret != SUCCESS)
+			goto error;
+
+		ret = XSpi_SetSlaveSelect(xdesc->instance,
+					  0x01 << desc->chip_select);
+		if (ret != SUCCESS)
+			goto error;
+
+		for (i = 0; i < msgs_number; i++) {
+			tx = msgs[i].tx_buff;
+			if (!tx) {
+				/* the core always shifts out, send zeros */
+				memset(msgs[i].rx_buff, 0, msgs[i].bytes_number);
+				tx = msgs[i].rx_buff;
+			}
+			ret = XSpi_Transfer(xdesc->instance, tx, msgs[i].rx_buff,
+					    msgs[i].bytes_number);
+			if (ret != SUCCESS)
+				goto pl_error;
+			if (msgs[i].cs_change || (i == msgs_number - 1))
+				XSpi_SetSlaveSelectReg((XSpi *)xdesc->instance,
+						       ((XSpi *)xdesc->instance)->SlaveSelectMask);
+			if (msgs[i].delay_usecs)
+				udelay(msgs[i].delay_usecs);
+		}
+
+		break;
+pl_error:
+		XSpi_SetSlaveSelectReg((XSpi *)xdesc->instance,
+				       ((XSpi *)xdesc->instance)->SlaveSelectMask);
+#endif
+		goto error;
+	case SPI_PS:
+#ifdef XSPIPS_H
+		ret = XSpiPs_SetOptions(xdesc->instance,
+					XSPIPS_MASTER_OPTION |
+					((xdesc->flags & SPI_CS_DECODE) ?
+					 XSPIPS_DECODE_SSELECT_OPTION : 0) |
+					XSPIPS_FORCE_SSELECT_OPTION |
+					((desc->mode & SPI_CPOL) ?
+					 XSPIPS_CLK_ACTIVE_LOW_OPTION : 0) |
+					((desc->mode & SPI_CPHA) ?
+					 XSPIPS_CLK_PHASE_1_OPTION : 0));
+		if (ret != SUCCESS)
+			goto error;
+
+		ret = XSpiPs_SetSlaveSelect(xdesc->instance,
+					    desc->chip_select);
+		if (ret != SUCCESS)
+			goto error;
+
+		for (i = 0; i < msgs_number; i = j + 1) {
+			/* A frame ends with the first segment changing the chip
+			 * select, or with the message. */
+			for (j = i; j < msgs_number - 1; j++)
+				if (msgs[j].cs_change)
+					break;
+			ret = spi_ps_transfer_frame(xdesc, &msgs[i], j - i + 1);
+			if (ret != SUCCESS)
+				goto ps_error;
+			if (msgs[j].delay_usecs)
+				udelay(msgs[j].delay_usecs);
+		}
+
+		ret = XSpiPs_SetSlaveSelect(xdesc->instance, SPI_DEASSERT_CURRENT_SS);
+		if (ret != SUCCESS)
+			goto error;
+
+		break;
+ps_error:
+		XSpiPs_SetSlaveSelect(xdesc->instance, SPI_DEASSERT_CURRENT_SS);
+#endif
+		goto error;
+	case SPI_ENGINE:
+#ifdef SPI_ENGINE_H
+
+#endif
+		/* Intended fallthrough */
+error:
+	default:
+		return FAILURE;
+		break;
+	}
+
+	return SUCCESS;
+}
@@ -96,6 +96,10 @@ typedef struct xil_spi_desc {
 	void			*config;
 	/** SPI instance */
 	void			*instance;
+	/** Bounce buffer gathering the segments of a chip select frame */
+	uint8_t			*bounce;
+	/** Size of the bounce buffer */
+	uint32_t		bounce_size;
 } xil_spi_desc;
 
 #endif // SPI_EXTRA_H_
\ No newline at end of file
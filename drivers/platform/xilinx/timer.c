@@ -0,0 +1,197 @@
+/***************************************************************************//**
+ *   @file   xilinx/timer.c
+ *   @brief  Implementation of Xilinx Timer Functions.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <xparameters.h>
+#ifdef _XPARAMETERS_PS_H_
+#include <xtime_l.h>
+#endif
+#include "error.h"
+#include "timer.h"
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Initialize the timer handler.
+ *
+ * The timer is the free running global timer of the processing system, which
+ * is also used by the delay functions and can neither be stopped nor reloaded.
+ * Only available on the PS (Zynq, ZynqMP) targets.
+ * @param [out] desc - Pointer to the reference of the device handler.
+ * @param [in] param - Initialization structure. freq_hz must be 0 or the
+ *                     global timer frequency, load_value must be 0.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_init(struct timer_desc **desc,
+		   struct timer_init_param *param)
+{
+#ifdef _XPARAMETERS_PS_H_
+	struct timer_desc *dev;
+
+	if (!desc || !param)
+		return FAILURE;
+
+	if ((param->freq_hz && (param->freq_hz != COUNTS_PER_SECOND)) ||
+	    param->load_value)
+		return FAILURE;
+
+	dev = (struct timer_desc *)calloc(1, sizeof(*dev));
+	if (!dev)
+		return FAILURE;
+
+	dev->freq_hz = COUNTS_PER_SECOND;
+	dev->extra = param->extra;
+
+	*desc = dev;
+
+	return SUCCESS;
+#else
+	return FAILURE;
+#endif
+}
+
+/**
+ * @brief Free the memory allocated by timer_init().
+ * @param [in] desc - Pointer to the device handler.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_remove(struct timer_desc *desc)
+{
+	if (!desc)
+		return FAILURE;
+
+	free(desc);
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Start a timer. The global timer is always running.
+ * @param [in] desc - Pointer to the device handler.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_start(struct timer_desc *desc)
+{
+	if (!desc)
+		return FAILURE;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Stop a timer from counting. Not supported, the global timer is shared
+ *        with the delay functions.
+ * @param [in] desc - Pointer to the device handler.
+ * @return FAILURE.
+ */
+int32_t timer_stop(struct timer_desc *desc)
+{
+	return FAILURE;
+}
+
+/**
+ * @brief Get the value of the counter register for the timer.
+ * @param [in]  desc    - Pointer to the device handler.
+ * @param [out] counter - Pointer to the counter value, the low 32 bits of the
+ *                        global timer.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_counter_get(struct timer_desc *desc, uint32_t *counter)
+{
+#ifdef _XPARAMETERS_PS_H_
+	XTime now;
+
+	if (!desc || !counter)
+		return FAILURE;
+
+	XTime_GetTime(&now);
+	*counter = (uint32_t)now;
+
+	return SUCCESS;
+#else
+	return FAILURE;
+#endif
+}
+
+/**
+ * @brief Set the timer counter register value. Not supported.
+ * @param [in] desc    - Pointer to the device handler.
+ * @param [in] new_val - The new value of the counter register.
+ * @return FAILURE.
+ */
+int32_t timer_counter_set(struct timer_desc *desc, uint32_t new_val)
+{
+	return FAILURE;
+}
+
+/**
+ * @brief Get the timer clock frequency.
+ * @param [in]  desc    - Pointer to the device handler.
+ * @param [out] freq_hz - The value in Hz of the timer clock.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_count_clk_get(struct timer_desc *desc, uint32_t *freq_hz)
+{
+	if (!desc || !freq_hz)
+		return FAILURE;
+
+	*freq_hz = desc->freq_hz;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Set the timer clock frequency. Only the fixed global timer frequency
+ *        is accepted.
+ * @param [in] desc    - Pointer to the device handler.
+ * @param [in] freq_hz - The value in Hz of the new timer clock.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t timer_count_clk_set(struct timer_desc *desc, uint32_t freq_hz)
+{
+	if (!desc || (freq_hz != desc->freq_hz))
+		return FAILURE;
+
+	return SUCCESS;
+}
@@ -35,8 +35,8 @@
 #include <xparameters.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "error.h"
-#include "fifo.h"
 #include "irq.h"
 #include "uart.h"
 #include "uart_extra.h"
@@ -56,78 +56,46 @@
 /******************************************************************************/
 
 /**
- * @brief Save received data into fifo.
- * @param desc - Instance descriptor containing a fifo element.
- * @return SUCCESS in case of success, FAILURE otherwise.
- */
-static int32_t uart_fifo_insert(struct uart_desc *desc)
-{
-	int32_t ret;
-	struct xil_uart_desc *xil_uart_desc = desc->extra;
-	struct irq_desc	*irq_desc = xil_uart_desc->irq_desc;
-
-	if (xil_uart_desc->bytes_received > 0) {
-		ret = irq_source_disable(irq_desc, xil_uart_desc->irq_id);
-		if (ret < 0)
-			return ret;
-		ret = fifo_insert(&xil_uart_desc->fifo, xil_uart_desc->buff,
-				  xil_uart_desc->bytes_received);
-		if (ret < 0)
-			return ret;
-		xil_uart_desc->bytes_received = 0;
-		switch(xil_uart_desc->type) {
-		case UART_PS:
-#ifdef XUARTPS_H
-			XUartPs_Recv(xil_uart_desc->instance, (u8*)(xil_uart_desc->buff),
-				     UART_BUFF_LENGTH);
-			break;
-#endif // XUARTPS_H
-		case UART_PL:
-
-			break;
-		default:
-			return FAILURE;
-			break;
-		}
-		ret = irq_source_enable(irq_desc, xil_uart_desc->irq_id);
-		if (ret < 0)
-			return ret;
-	}
-
-	return SUCCESS;
-}
-
-/**
- * @brief Read byte from fifo.
- * @param desc - Instance descriptor containing a fifo element
- * @param data - read value.
- * @return SUCCESS in case of success, FAILURE otherwise.
+ * @brief Point the UART driver to the free contiguous space of the receive
+ * ring, received bytes are stored there directly.
+ * Runs in interrupt context or with the UART interrupt disabled.
+ * @param xil_uart_desc - Xilinx UART descriptor.
  */
-static int32_t uart_read_byte(struct uart_desc *desc, uint8_t *data)
+static void uart_rx_arm(struct xil_uart_desc *xil_uart_desc)
 {
-	struct xil_uart_desc *xil_uart_desc = desc->extra;
-	int32_t ret;
-
-	while (xil_uart_desc->fifo == NULL) {
-		/* nothing in fifo, wait until something is received */
-		ret = uart_fifo_insert(desc);
-		if (ret < 0)
-			return ret;
+	uint32_t head = xil_uart_desc->rx_head;
+	uint32_t space, offset;
+
+	space = UART_RX_RING_SIZE - (head - xil_uart_desc->rx_tail);
+	offset = head & (UART_RX_RING_SIZE - 1);
+	if (space > UART_RX_RING_SIZE - offset)
+		space = UART_RX_RING_SIZE - offset;
+
+	if (!space) {
+		/* ring full, "uart_read()" re-arms when it makes room */
+		xil_uart_desc->rx_stalled = true;
+		return;
 	}
 
-	*data = xil_uart_desc->fifo->data[xil_uart_desc->fifo_read_offset];
-	xil_uart_desc->fifo_read_offset++;
+	xil_uart_desc->rx_stalled = false;
+	switch(xil_uart_desc->type) {
+	case UART_PS:
+#ifdef XUARTPS_H
+		XUartPs_Recv(xil_uart_desc->instance,
+			     &xil_uart_desc->rx_ring[offset], space);
+		break;
+#endif // XUARTPS_H
+	case UART_PL:
 
-	if (xil_uart_desc->fifo->len - xil_uart_desc->fifo_read_offset <= 0) {
-		xil_uart_desc->fifo_read_offset = 0;
-		xil_uart_desc->fifo = fifo_remove(xil_uart_desc->fifo);
+		break;
+	default:
+		break;
 	}
-
-	return SUCCESS;
 }
 
 /**
  * @brief Read data from UART device.
+ * Data is copied out of the receive ring, with at most two copies per pass.
  * @param desc - Instance of UART.
  * @param data - Pointer to buffer containing data.
  * @param bytes_number - Number of bytes to read.
@@ -135,11 +103,40 @@ static int32_t uart_read_byte(struct uart_desc *desc, uint8_t *data)
  */
 int32_t uart_read(struct uart_desc *desc, uint8_t *data, uint32_t bytes_number)
 {
-	ssize_t ret;
-	for (uint32_t i = 0; i < bytes_number; i++) {
-		ret = uart_read_byte(desc, &data[i]);
-		if (ret < 0)
-			return ret;
+	struct xil_uart_desc *xil_uart_desc = desc->extra;
+	uint32_t offset = 0, tail, len, chunk;
+	int32_t ret;
+
+	while (offset < bytes_number) {
+		tail = xil_uart_desc->rx_tail;
+		len = xil_uart_desc->rx_head - tail;
+		if (!len)
+			/* nothing received, wait until something is received */
+			continue;
+		if (len > bytes_number - offset)
+			len = bytes_number - offset;
+
+		chunk = UART_RX_RING_SIZE - (tail & (UART_RX_RING_SIZE - 1));
+		if (chunk > len)
+			chunk = len;
+		memcpy(data + offset,
+		       &xil_uart_desc->rx_ring[tail & (UART_RX_RING_SIZE - 1)], chunk);
+		memcpy(data + offset + chunk, xil_uart_desc->rx_ring, len - chunk);
+
+		offset += len;
+		xil_uart_desc->rx_tail = tail + len;
+
+		if (xil_uart_desc->rx_stalled) {
+			ret = irq_source_disable(xil_uart_desc->irq_desc,
+						 xil_uart_desc->irq_id);
+			if (ret < 0)
+				return ret;
+			uart_rx_arm(xil_uart_desc);
+			ret = irq_source_enable(xil_uart_desc->irq_desc,
+						xil_uart_desc->irq_id);
+			if (ret < 0)
+				return ret;
+		}
 	}
 
 	return bytes_number;
@@ -204,7 +201,8 @@ static void uart_irq_handler(void *call_back_ref, uint32_t event,
 		 * timeout just indicates the data stopped for configured character time
 		 */
 		case XUARTPS_EVENT_RECV_TOUT:
-			xil_uart_desc->bytes_received = data_len;
+			xil_uart_desc->rx_head += data_len;
+			uart_rx_arm(xil_uart_desc);
 			break;
 		/*
 		 * Data was received with an error, keep the data but determine
@@ -355,8 +353,7 @@ int32_t uart_init(struct uart_desc **desc, struct uart_init_param *param)
 
 		*desc = descriptor;
 
-		XUartPs_Recv(xil_uart_desc->instance, (u8*)xil_uart_desc->buff,
-			     UART_BUFF_LENGTH);
+		uart_rx_arm(xil_uart_desc);
 
 		break;
 #endif // XUARTPS_H
@@ -44,11 +44,15 @@
 /***************************** Include Files **********************************/
 /******************************************************************************/
 
+#include <stdbool.h>
+#include <stdint.h>
+
 /******************************************************************************/
 /********************** Macros and Constants Definitions **********************/
 /******************************************************************************/
 
-#define UART_BUFF_LENGTH 256
+/** Size of the receive ring, must be a power of 2 */
+#define UART_RX_RING_SIZE 1024
 
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
@@ -90,14 +94,14 @@ struct xil_uart_desc {
 	uint32_t			irq_id;
 	/** Interrupt Request Descriptor */
 	struct irq_desc		*irq_desc;
-	/** FIFO */
-	struct fifo_element	*fifo;
-	/** FIFO read offset */
-	uint32_t 			fifo_read_offset;
-	/** UART Buffer */
-	char 				buff[UART_BUFF_LENGTH];
-	/** Number of bytes received */
-	uint32_t 			bytes_received;
+	/** Receive ring, filled by the interrupt handler */
+	uint8_t				rx_ring[UART_RX_RING_SIZE];
+	/** Receive ring write index, only written by the interrupt handler */
+	volatile uint32_t		rx_head;
+	/** Receive ring read index, only written by uart_read() */
+	volatile uint32_t		rx_tail;
+	/** Receive ring was full, reception is paused */
+	volatile bool			rx_stalled;
 	/** Total number of errors */
 	uint32_t 			total_error_count;
 	/** UART Instance */
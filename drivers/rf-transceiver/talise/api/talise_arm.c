@@ -802,17 +802,18 @@ uint32_t TALISE_writeArmMem(taliseDevice_t *device, uint32_t address,
 {
 	talRecoveryActions_t retVal = TALACT_NO_ACTION;
 	adiHalErr_t halError = ADIHAL_OK;
+	adiHalErr_t restoreError = ADIHAL_OK;
 	uint8_t dataMem = 0;
-	uint32_t i = 0;
 	uint8_t regWrite = 0;
-
-	uint32_t addrIndex = 0;
-	uint32_t dataIndex = 0;
-	uint32_t spiBufferSize = HAL_SPIWRITEARRAY_BUFFERSIZE;
-	uint16_t addrArray[HAL_SPIWRITEARRAY_BUFFERSIZE] = {0};
+	uint8_t spiConfigA = 0;
+	uint8_t spiConfigB = 0;
+	uint32_t headCount = 0;
 
 	static const uint8_t FORCE_AUTO_INC = 0x02;
 	static const uint8_t LEGACY_MODE_BIT = 0x20;
+	static const uint8_t SPI_ADDR_ASCENSION = 0x24;
+	static const uint8_t SPI_SINGLE_INSTRUCTION = 0x80;
+	static const uint32_t ARM_DMA_DATA_WIDTH = 4;
 
 #if TALISE_VERBOSE
 	talWriteToLog(device->devHalInfo, ADIHAL_LOG_MSG, TAL_ERR_OK,
@@ -864,32 +865,69 @@ uint32_t TALISE_writeArmMem(taliseDevice_t *device, uint32_t address,
 				  TALACT_ERR_RESET_SPI);
 	IF_ERR_RETURN_U32(retVal);
 
-	/* starting write at zero address offset */
-	for (i = 0; i < byteCount; i++) {
-		addrArray[addrIndex++] = (uint16_t)(TALISE_ADDR_ARM_DMA_DATA0 + (((
-				address & 0x3) + i) % 4));
+	/* The data port is DATA0..DATA3, a word is committed when DATA3 is
+	 * written and the DMA address then auto-increments. Stream one word per
+	 * SPI transaction, which needs SPI streaming with ascending addresses. */
+	halError = talSpiReadByte(device->devHalInfo,
+				  TALISE_ADDR_SPI_INTERFACE_CONFIG_A, &spiConfigA);
+	retVal = talApiErrHandler(device,TAL_ERRHDL_HAL_SPI, halError, retVal,
+				  TALACT_ERR_RESET_SPI);
+	IF_ERR_RETURN_U32(retVal);
 
-		if (addrIndex == spiBufferSize) {
-			halError = talSpiWriteBytes(device->devHalInfo, &addrArray[0], &data[dataIndex],
-						    addrIndex);
-			retVal = talApiErrHandler(device,TAL_ERRHDL_HAL_SPI, halError, retVal,
-						  TALACT_ERR_RESET_SPI);
-			IF_ERR_RETURN_U32(retVal);
+	halError = talSpiReadByte(device->devHalInfo,
+				  TALISE_ADDR_SPI_INTERFACE_CONFIG_B, &spiConfigB);
+	retVal = talApiErrHandler(device,TAL_ERRHDL_HAL_SPI, halError, retVal,
+				  TALACT_ERR_RESET_SPI);
+	IF_ERR_RETURN_U32(retVal);
 
-			dataIndex = dataIndex + addrIndex;
-			addrIndex = 0;
+	halError = talSpiWriteByte(device->devHalInfo,
+				   TALISE_ADDR_SPI_INTERFACE_CONFIG_A,
+				   spiConfigA | SPI_ADDR_ASCENSION);
+	retVal = talApiErrHandler(device,TAL_ERRHDL_HAL_SPI, halError, retVal,
+				  TALACT_ERR_RESET_SPI);
+	IF_ERR_RETURN_U32(retVal);
+
+	halError = talSpiWriteByte(device->devHalInfo,
+				   TALISE_ADDR_SPI_INTERFACE_CONFIG_B,
+				   spiConfigB & ~SPI_SINGLE_INSTRUCTION);
+	retVal = talApiErrHandler(device,TAL_ERRHDL_HAL_SPI, halError, retVal,
+				  TALACT_ERR_RESET_SPI);
+	IF_ERR_RETURN_U32(retVal);
+
+	/* a start address that is not word aligned begins inside the port */
+	if ((address & 0x3) != 0) {
+		headCount = ARM_DMA_DATA_WIDTH - (address & 0x3);
+		if (headCount > byteCount) {
+			headCount = byteCount;
 		}
+
+		halError = talSpiWriteStream(device->devHalInfo,
+					     (uint16_t)(TALISE_ADDR_ARM_DMA_DATA0 + (address & 0x3)),
+					     &data[0], headCount, 0);
 	}
 
-	/* write remaining SPI bytes that did not fit  into a multiple of the spiBufferSize */
-	if (addrIndex > 0) {
-		halError = talSpiWriteBytes(device->devHalInfo, &addrArray[0], &data[dataIndex],
-					    addrIndex);
-		retVal = talApiErrHandler(device,TAL_ERRHDL_HAL_SPI, halError, retVal,
-					  TALACT_ERR_RESET_SPI);
-		IF_ERR_RETURN_U32(retVal);
+	if ((halError == ADIHAL_OK) && (headCount < byteCount)) {
+		halError = talSpiWriteStream(device->devHalInfo, TALISE_ADDR_ARM_DMA_DATA0,
+					     &data[headCount], byteCount - headCount,
+					     ARM_DMA_DATA_WIDTH);
+	}
+
+	/* restore the SPI mode, also when the load failed */
+	restoreError = talSpiWriteByte(device->devHalInfo,
+				       TALISE_ADDR_SPI_INTERFACE_CONFIG_B, spiConfigB);
+	if (restoreError == ADIHAL_OK) {
+		restoreError = talSpiWriteByte(device->devHalInfo,
+					       TALISE_ADDR_SPI_INTERFACE_CONFIG_A, spiConfigA);
 	}
 
+	if (halError == ADIHAL_OK) {
+		halError = restoreError;
+	}
+
+	retVal = talApiErrHandler(device,TAL_ERRHDL_HAL_SPI, halError, retVal,
+				  TALACT_ERR_RESET_SPI);
+	IF_ERR_RETURN_U32(retVal);
+
 	return (uint32_t)retVal;
 }
 
@@ -1096,8 +1134,8 @@ uint32_t TALISE_waitArmCmdStatus(taliseDevice_t *device, uint8_t opCode,
 {
 	talRecoveryActions_t retVal = TALACT_NO_ACTION;
 	adiHalErr_t halError = ADIHAL_OK;
-	uint32_t eventCheck = 0;
-	uint32_t numEventChecks = 0;
+	uint32_t waitedTime_us = 0;
+	uint32_t wait_us = 0;
 
 	static const uint8_t ARM_ERR_MASK = 0x0E;
 
@@ -1116,11 +1154,13 @@ uint32_t TALISE_waitArmCmdStatus(taliseDevice_t *device, uint8_t opCode,
 						  TAL_ERR_WAITARMCMDSTATUS_INV_OPCODE, retVal, TALACT_ERR_CHECK_PARAM);
 	}
 
-	waitInterval_us = (waitInterval_us > timeout_us) ? timeout_us : waitInterval_us;
-	numEventChecks = (waitInterval_us == 0) ? 1 : (timeout_us / waitInterval_us);
+	waitInterval_us = ((waitInterval_us > timeout_us) ||
+			   (waitInterval_us == 0)) ? timeout_us : waitInterval_us;
+	wait_us = (waitInterval_us > WAIT_MIN_INTERVAL_US) ? WAIT_MIN_INTERVAL_US :
+		  waitInterval_us;
 
-	/* timeout event check loop */
-	for (eventCheck = 0; eventCheck <= numEventChecks; eventCheck++) {
+	/* timeout event check loop, polls fast first then backs off up to waitInterval_us */
+	for (;;) {
 		/* read status of opcode */
 		retVal = (talRecoveryActions_t)TALISE_readArmCmdStatusByte(device, opCode,
 				cmdStatByte);
@@ -1134,10 +1174,14 @@ uint32_t TALISE_waitArmCmdStatus(taliseDevice_t *device, uint8_t opCode,
 
 		/* if pending bit is set for opcode of interest and the number of events have not expired, perform wait */
 		if (((*cmdStatByte & 0x01) > 0) &&
-		    (eventCheck < numEventChecks)) {
-			halError = ADIHAL_wait_us(device->devHalInfo, waitInterval_us);
+		    (waitedTime_us < timeout_us)) {
+			wait_us = (wait_us > (timeout_us - waitedTime_us)) ?
+				  (timeout_us - waitedTime_us) : wait_us;
+			halError = ADIHAL_wait_us(device->devHalInfo, wait_us);
 			retVal = talApiErrHandler(device, TAL_ERRHDL_HAL_WAIT, halError, retVal,
 						  TALACT_ERR_CHECK_TIMER);
+			waitedTime_us += wait_us;
+			wait_us = ((wait_us * 2) > waitInterval_us) ? waitInterval_us : (wait_us * 2);
 		} else {
 			break;
 		}
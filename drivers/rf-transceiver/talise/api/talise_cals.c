@@ -1193,8 +1193,8 @@ uint32_t TALISE_waitForEvent(taliseDevice_t *device,
 	uint8_t  spiBit=0;
 	uint8_t  doneBitLevel=0;
 	uint8_t  data=0;
-	uint32_t numEventChecks = 1;
-	uint32_t eventCheck = 0;
+	uint32_t waitedTime_us = 0;
+	uint32_t wait_us = 0;
 
 	static const uint32_t CODECHECK_PARAM_WAITFOREVENT_ERR1 = 1;
 	static const uint32_t CODECHECK_PARAM_WAITFOREVENT_ERR2 = 2;
@@ -1263,10 +1263,13 @@ uint32_t TALISE_waitForEvent(taliseDevice_t *device,
 						  TAL_ERR_WAITFOREVENT_INV_PARM, retVal, TALACT_ERR_CHECK_PARAM);
 	}
 
-	waitInterval_us = (waitInterval_us > timeout_us) ? timeout_us : waitInterval_us;
-	numEventChecks = (waitInterval_us == 0) ? 1 : (timeout_us / waitInterval_us);
+	waitInterval_us = ((waitInterval_us > timeout_us) ||
+			   (waitInterval_us == 0)) ? timeout_us : waitInterval_us;
+	wait_us = (waitInterval_us > WAIT_MIN_INTERVAL_US) ? WAIT_MIN_INTERVAL_US :
+		  waitInterval_us;
 
-	for (eventCheck = 0; eventCheck <= numEventChecks; eventCheck++) {
+	/* poll fast first, then back off up to waitInterval_us */
+	for (;;) {
 		halError = talSpiReadByte(device->devHalInfo, spiAddr, &data);
 		retVal = talApiErrHandler(device,TAL_ERRHDL_HAL_SPI, halError, retVal,
 					  TALACT_ERR_RESET_SPI);
@@ -1287,11 +1290,15 @@ uint32_t TALISE_waitForEvent(taliseDevice_t *device,
 			doneBitLevel = 1;
 		}
 		if ((((data >> spiBit) & 0x01) != doneBitLevel) &&
-		    (eventCheck < numEventChecks)) {
-			halError = ADIHAL_wait_us(device->devHalInfo, waitInterval_us);
+		    (waitedTime_us < timeout_us)) {
+			wait_us = (wait_us > (timeout_us - waitedTime_us)) ?
+				  (timeout_us - waitedTime_us) : wait_us;
+			halError = ADIHAL_wait_us(device->devHalInfo, wait_us);
 			retVal = talApiErrHandler(device, TAL_ERRHDL_HAL_WAIT, halError, retVal,
 						  TALACT_ERR_CHECK_TIMER);
 			IF_ERR_RETURN_U32(retVal);
+			waitedTime_us += wait_us;
+			wait_us = ((wait_us * 2) > waitInterval_us) ? waitInterval_us : (wait_us * 2);
 		} else {
 			break;
 		}
@@ -141,6 +141,27 @@ adiHalErr_t talSpiReadByte(void *devHalInfo, uint16_t addr, uint8_t *readdata);
 adiHalErr_t talSpiWriteBytes(void *devHalInfo, uint16_t *addr, uint8_t *data,
 			     uint32_t count);
 
+/**
+ * \brief Wrapper function for ADIHAL_spiWriteStream with error handling
+ *
+ * This function can be called any time after the devHalInfo has been initialized
+ * with valid settings by the user
+ *
+ * \dep_begin
+ * \dep{devHalInfo}
+ * \dep_end
+ *
+ * \param devHalInfo Pointer to device HAL information container
+ * \param addr 16-bit SPI address of the first register of the data window
+ * \param data Pointer to byte array to be streamed
+ * \param count Number of bytes to be written
+ * \param frameSize Number of bytes written per SPI transaction
+ *
+ * \retval Returns adiHalErr_t enumerated type
+ */
+adiHalErr_t talSpiWriteStream(void *devHalInfo, uint16_t addr, uint8_t *data,
+			      uint32_t count, uint32_t frameSize);
+
 /**
  * \brief Wrapper function for ADIHAL_spiReadBytes with error handling
  *
@@ -17,6 +17,8 @@ extern "C" {
 
 #include "talise_types.h"
 
+/* first wait of the event poll loops, doubled up to the caller's interval */
+#define WAIT_MIN_INTERVAL_US              10
 #define VERIFY_ARM_CHKSUM_TIMEOUT_US  200000
 #define VERIFY_ARM_CHKSUM_INTERVAL_US   5000
 #define CLKPLL_CPCAL_TIMEOUT_US      1000000
@@ -54,6 +54,21 @@
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
 
+/**
+ * @struct iio_attr_index
+ * @brief Attribute list sorted by name, for binary search lookups.
+ */
+struct iio_attr_index {
+	/** Indexed attribute list */
+	struct iio_attribute **attributes;
+	/** Number of attributes */
+	uint16_t num;
+	/** Attribute IDs, sorted by attribute name */
+	uint16_t *order;
+	/** "order" belongs to another index of the same attribute list */
+	bool shared;
+};
+
 /**
  * @struct iio_interface
  * @brief Links a physical device instance "void *dev_instance"
@@ -82,6 +97,14 @@ struct iio_interface {
 	/** Write data to RAM. It should be called before "transfer_mem_to_dev" */
 	ssize_t (*write_data)(void *dev_instance, char *pbuf, size_t offset,
 			      size_t bytes_count, uint32_t ch_mask);
+	/** Number of channels */
+	uint16_t num_ch;
+	/** Channel IDs, sorted by channel name and direction */
+	uint16_t *ch_order;
+	/** Device attributes index */
+	struct iio_attr_index dev_attr_idx;
+	/** Attributes index of each channel */
+	struct iio_attr_index *ch_attr_idx;
 };
 
 /**
@@ -89,7 +112,7 @@ struct iio_interface {
  * @brief Structure containing all interfaces.
  */
 struct iio_interfaces {
-	/** List containing all interfaces */
+	/** List containing all interfaces, sorted by name */
 	struct iio_interface **interfaces;
 	/** Number of Interfaces */
 	uint8_t num_interfaces;
@@ -115,6 +138,18 @@ struct element_info {
  */
 static struct iio_interfaces *iio_interfaces = NULL;
 
+/**
+ * Interface found by the last lookup, consecutive commands usually target the
+ * same device.
+ */
+static struct iio_interface *iio_last_interface = NULL;
+
+/** Context xml, built on first request and dropped when interfaces change */
+static char *iio_xml = NULL;
+
+/** Length of "iio_xml" */
+static uint32_t iio_xml_len = 0;
+
 /******************************************************************************/
 /************************ Functions Definitions *******************************/
 /******************************************************************************/
@@ -141,47 +176,77 @@ static int32_t iio_get_channel_number(const char *ch)
 }
 
 /**
- * @brief Get channel ID from a list of channels.
+ * @brief Compare two channels by name, then by direction.
+ * @param name - Name of the first channel.
+ * @param ch_out - Direction of the first channel.
+ * @param channel - Second channel.
+ * @return Negative, zero or positive value, like strcmp().
+ */
+static int32_t iio_channel_cmp(const char *name, bool ch_out,
+			       const struct iio_channel *channel)
+{
+	int32_t ret = strcmp(name, channel->name);
+
+	if (ret)
+		return ret;
+
+	return (int32_t)ch_out - (int32_t)channel->ch_out;
+}
+
+/**
+ * @brief Get channel ID of an interface.
  * @param channel - Channel name.
- * @param channels - List of channels.
+ * @param iface - Interface.
  * @param ch_out - If "true" is output channel, if "false" is input channel.
- * @return Channel ID, or negative value if attribute is not found.
+ * @return Channel ID, or negative value if channel is not found.
  */
 static int16_t iio_get_channel_id(const char *channel,
-				  struct iio_channel **channels, bool ch_out)
+				  struct iio_interface *iface, bool ch_out)
 {
-	int16_t i = 0;
+	struct iio_channel **channels = iface->iio->channels;
+	int32_t lo = 0, hi = (int32_t)iface->num_ch - 1, mid, cmp;
 
-	if (!(*channels))
+	if (!iface->num_ch)
 		return -EINVAL;
 
-	while (channels[i]) {
-		if (!strcmp(channel, channels[i]->name) && (channels[i]->ch_out == ch_out))
-			return i;
-		i++;
+	while (lo <= hi) {
+		mid = (lo + hi) / 2;
+		cmp = iio_channel_cmp(channel, ch_out,
+				      channels[iface->ch_order[mid]]);
+		if (!cmp)
+			return iface->ch_order[mid];
+		if (cmp < 0)
+			hi = mid - 1;
+		else
+			lo = mid + 1;
 	}
 
 	return -ENOENT;
 }
 
 /**
- * @brief Get attribute ID from a list of attributes.
+ * @brief Get attribute ID from an attribute index.
  * @param attr - Attribute name.
- * @param attributes - List of attributes.
+ * @param idx - Attribute index.
  * @return - Attribute ID, or negative value if attribute is not found.
  */
 static int16_t iio_get_attribute_id(const char *attr,
-				    struct iio_attribute **attributes)
+				    const struct iio_attr_index *idx)
 {
-	int16_t i = 0;
+	int32_t lo = 0, hi = (int32_t)idx->num - 1, mid, cmp;
 
-	if (!(*attributes))
+	if (!idx->num)
 		return -EINVAL;
 
-	while (attributes[i]) {
-		if (!strcmp(attr, attributes[i]->name))
-			return i;
-		i++;
+	while (lo <= hi) {
+		mid = (lo + hi) / 2;
+		cmp = strcmp(attr, idx->attributes[idx->order[mid]]->name);
+		if (!cmp)
+			return idx->order[mid];
+		if (cmp < 0)
+			hi = mid - 1;
+		else
+			lo = mid + 1;
 	}
 
 	return -ENOENT;
@@ -196,19 +261,159 @@ static int16_t iio_get_attribute_id(const char *attr,
 static struct iio_interface *iio_get_interface(const char *device_name,
 		struct iio_interfaces *iio_interfaces)
 {
-	int16_t i;
+	struct iio_interface *iface;
+	int32_t lo, hi, mid, cmp;
 
-	if (!iio_interfaces)
+	if (!iio_interfaces || !device_name)
 		return NULL;
 
-	for (i = 0; i < iio_interfaces->num_interfaces; i++) {
-		if (!strcmp(device_name, iio_interfaces->interfaces[i]->name))
-			return iio_interfaces->interfaces[i];
+	if (iio_last_interface && !strcmp(device_name, iio_last_interface->name))
+		return iio_last_interface;
+
+	lo = 0;
+	hi = (int32_t)iio_interfaces->num_interfaces - 1;
+	while (lo <= hi) {
+		mid = (lo + hi) / 2;
+		iface = iio_interfaces->interfaces[mid];
+		cmp = strcmp(device_name, iface->name);
+		if (!cmp) {
+			iio_last_interface = iface;
+			return iface;
+		}
+		if (cmp < 0)
+			hi = mid - 1;
+		else
+			lo = mid + 1;
 	}
 
 	return NULL;
 }
 
+/**
+ * @brief Build the index of an attribute list.
+ * @param idx - Index to be built.
+ * @param attributes - NULL terminated attribute list, may be NULL.
+ * @return SUCCESS in case of success or negative value otherwise.
+ */
+static ssize_t iio_attr_index_init(struct iio_attr_index *idx,
+				   struct iio_attribute **attributes)
+{
+	uint16_t i, j;
+
+	idx->attributes = attributes;
+	idx->num = 0;
+	idx->order = NULL;
+	idx->shared = false;
+
+	if (!attributes)
+		return SUCCESS;
+
+	while (attributes[idx->num])
+		idx->num++;
+	if (!idx->num)
+		return SUCCESS;
+
+	idx->order = (uint16_t *)calloc(idx->num, sizeof(*idx->order));
+	if (!idx->order)
+		return -ENOMEM;
+
+	/* Insertion sort, the lists are short and only sorted once. */
+	for (i = 0; i < idx->num; i++) {
+		for (j = i; j > 0; j--) {
+			if (strcmp(attributes[i]->name,
+				   attributes[idx->order[j - 1]]->name) >= 0)
+				break;
+			idx->order[j] = idx->order[j - 1];
+		}
+		idx->order[j] = i;
+	}
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Free the lookup index of an interface.
+ * @param iface - Interface.
+ */
+static void iio_interface_index_remove(struct iio_interface *iface)
+{
+	uint16_t i;
+
+	if (iface->ch_attr_idx) {
+		for (i = 0; i < iface->num_ch; i++)
+			if (!iface->ch_attr_idx[i].shared)
+				free(iface->ch_attr_idx[i].order);
+		free(iface->ch_attr_idx);
+	}
+	free(iface->dev_attr_idx.order);
+	free(iface->ch_order);
+}
+
+/**
+ * @brief Build the lookup index of an interface: channels sorted by name and
+ * direction, attributes of the device and of each channel sorted by name.
+ * Channels sharing the same attribute list share its index.
+ * @param iface - Interface.
+ * @return SUCCESS in case of success or negative value otherwise.
+ */
+static ssize_t iio_interface_index_init(struct iio_interface *iface)
+{
+	struct iio_channel **channels;
+	uint16_t i, j;
+	ssize_t ret;
+
+	if (!iface->iio)
+		return SUCCESS;
+
+	ret = iio_attr_index_init(&iface->dev_attr_idx, iface->iio->attributes);
+	if (ret < 0)
+		return ret;
+
+	channels = iface->iio->channels;
+	iface->num_ch = 0;
+	if (channels)
+		while (channels[iface->num_ch])
+			iface->num_ch++;
+	if (!iface->num_ch)
+		return SUCCESS;
+
+	iface->ch_order = (uint16_t *)calloc(iface->num_ch,
+					     sizeof(*iface->ch_order));
+	iface->ch_attr_idx = (struct iio_attr_index *)calloc(iface->num_ch,
+			     sizeof(*iface->ch_attr_idx));
+	if (!iface->ch_order || !iface->ch_attr_idx)
+		goto error;
+
+	for (i = 0; i < iface->num_ch; i++) {
+		for (j = i; j > 0; j--) {
+			if (iio_channel_cmp(channels[i]->name, channels[i]->ch_out,
+					    channels[iface->ch_order[j - 1]]) >= 0)
+				break;
+			iface->ch_order[j] = iface->ch_order[j - 1];
+		}
+		iface->ch_order[j] = i;
+
+		for (j = 0; j < i; j++)
+			if (channels[j]->attributes == channels[i]->attributes)
+				break;
+		if (j < i) {
+			iface->ch_attr_idx[i] = iface->ch_attr_idx[j];
+			iface->ch_attr_idx[i].shared = true;
+			continue;
+		}
+		ret = iio_attr_index_init(&iface->ch_attr_idx[i],
+					  channels[i]->attributes);
+		if (ret < 0)
+			goto error;
+	}
+
+	return SUCCESS;
+error:
+	iio_interface_index_remove(iface);
+
+	return -ENOMEM;
+}
+
 /**
  * @brief Read all attributes from an attribute list.
  * @param device - Physical instance of a device.
@@ -288,18 +493,18 @@ static ssize_t iio_write_all_attr(void *device, char *buf, size_t len,
  * @param el_info - Structure describing element to be written.
  * @param buf - Read/write value.
  * @param len - Length of data in "buf" parameter.
- * @param channel - Structure describing channel attributes.
+ * @param iface - Interface of the device.
+ * @param channel_id - Channel ID.
  * @param is_write -If it has value "1", writes attribute, otherwise reads
  * 		attribute.
  * @return Length of chars written/read or negative value in case of error.
  */
 static ssize_t iio_rd_wr_channel_attribute(struct element_info *el_info,
 		char *buf, size_t len,
-		struct iio_channel *channel, bool is_write)
+		struct iio_interface *iface, int16_t channel_id, bool is_write)
 {
 	int16_t attribute_id;
-	struct iio_interface *iface = iio_get_interface(el_info->device_name,
-				      iio_interfaces);
+	struct iio_channel *channel = iface->iio->channels[channel_id];
 	const struct iio_ch_info channel_info = {
 		iio_get_channel_number(el_info->channel_name),
 		el_info->ch_out
@@ -316,7 +521,7 @@ static ssize_t iio_rd_wr_channel_attribute(struct element_info *el_info,
 	} else {
 		/* read / write single channel attribute, if attribute found */
 		attribute_id = iio_get_attribute_id(el_info->attribute_name,
-						    channel->attributes);
+						    &iface->ch_attr_idx[channel_id]);
 		if (attribute_id >= 0) {
 			if (is_write)
 				return channel->attributes[attribute_id]->store(iface->dev_instance,
@@ -335,26 +540,24 @@ static ssize_t iio_rd_wr_channel_attribute(struct element_info *el_info,
  * @param el_info - Structure describing element to be written.
  * @param buf - Read/write value.
  * @param len - Length of data in "buf" parameter.
- * @param iio_device - Physical instance of a device.
+ * @param iface - Interface of the device.
  * @param is_write -If it has value "1", writes attribute, otherwise reads
  * 		attribute.
  * @return Length of chars written/read or negative value in case of error.
  */
 static ssize_t iio_rd_wr_attribute(struct element_info *el_info, char *buf,
 				   size_t len,
-				   struct iio_device *iio_device, bool is_write)
+				   struct iio_interface *iface, bool is_write)
 {
 	int16_t channel_id;
 	int16_t attribute_id;
-	struct iio_interface *iface;
+	struct iio_device *iio_device = iface->iio;
 
 	if (!iio_device)
 		return -ENOENT;
 
 	if (!strcmp(el_info->channel_name, "")) {
 		/* it is attribute of a device */
-		iface = iio_get_interface(el_info->device_name, iio_interfaces);
-
 		if (!strcmp(el_info->attribute_name, "")) {
 			/* read / write all device attributes */
 			if (is_write)
@@ -366,7 +569,7 @@ static ssize_t iio_rd_wr_attribute(struct element_info *el_info, char *buf,
 		} else {
 			/* read / write single device attribute, if attribute found */
 			attribute_id = iio_get_attribute_id(el_info->attribute_name,
-							    iio_device->attributes);
+							    &iface->dev_attr_idx);
 			if (attribute_id < 0)
 				return -ENOENT;
 			if (is_write)
@@ -378,25 +581,17 @@ static ssize_t iio_rd_wr_attribute(struct element_info *el_info, char *buf,
 		}
 	} else {
 		/* it is attribute of a channel */
-		channel_id = iio_get_channel_id(el_info->channel_name, iio_device->channels,
+		channel_id = iio_get_channel_id(el_info->channel_name, iface,
 						el_info->ch_out);
-		return iio_rd_wr_channel_attribute(el_info, buf, len,
-						   iio_device->channels[channel_id], is_write);
+		if (channel_id < 0)
+			return -ENOENT;
+		return iio_rd_wr_channel_attribute(el_info, buf, len, iface,
+						   channel_id, is_write);
 	}
 
 	return -ENOENT;
 }
 
-/**
- * @brief Check if device is supported.
- * @param device - Device name.
- * @return TRUE if device is supported, FALSE otherwise.
- */
-static bool iio_supported_dev(const char *device)
-{
-	return (NULL != iio_get_interface(device, iio_interfaces));
-}
-
 /**
  * @brief Read global attribute of a device.
  * @param device - String containing device name.
@@ -412,18 +607,15 @@ static ssize_t iio_read_attr(const char *device, const char *attr, char *buf,
 	struct iio_interface *iio_device;
 	struct element_info el_info;
 
-	if (!iio_supported_dev(device))
+	iio_device = iio_get_interface(device, iio_interfaces);
+	if (!iio_device)
 		return FAILURE;
 
 	el_info.device_name = device;
 	el_info.channel_name = "";	/* there is no channel here */
 	el_info.attribute_name = attr;
 
-	iio_device = iio_get_interface(device, iio_interfaces);
-	if (!iio_device)
-		return FAILURE;
-
-	return iio_rd_wr_attribute(&el_info, buf, len, iio_device->iio, 0);
+	return iio_rd_wr_attribute(&el_info, buf, len, iio_device, 0);
 }
 
 /**
@@ -442,18 +634,15 @@ static ssize_t iio_write_attr(const char *device, const char *attr,
 	struct element_info el_info;
 	struct iio_interface *iio_interface;
 
-	if (!iio_supported_dev(device))
+	iio_interface = iio_get_interface(device, iio_interfaces);
+	if (!iio_interface)
 		return -ENODEV;
 
 	el_info.device_name = device;
 	el_info.channel_name = "";	/* there is no channel here */
 	el_info.attribute_name = attr;
 
-	iio_interface = iio_get_interface(device, iio_interfaces);
-	if (!iio_interface)
-		return FAILURE;
-
-	return iio_rd_wr_attribute(&el_info, (char*)buf, len, iio_interface->iio, 1);
+	return iio_rd_wr_attribute(&el_info, (char*)buf, len, iio_interface, 1);
 }
 
 /**
@@ -472,7 +661,8 @@ static ssize_t iio_ch_read_attr(const char *device, const char *channel,
 	struct element_info el_info;
 	struct iio_interface *iio_interface;
 
-	if (!iio_supported_dev(device))
+	iio_interface = iio_get_interface(device, iio_interfaces);
+	if (!iio_interface)
 		return FAILURE;
 
 	el_info.device_name = device;
@@ -480,11 +670,7 @@ static ssize_t iio_ch_read_attr(const char *device, const char *channel,
 	el_info.attribute_name = attr;
 	el_info.ch_out = ch_out;
 
-	iio_interface = iio_get_interface(device, iio_interfaces);
-	if (!device)
-		return FAILURE;
-
-	return iio_rd_wr_attribute(&el_info, buf, len, iio_interface->iio, 0);
+	return iio_rd_wr_attribute(&el_info, buf, len, iio_interface, 0);
 }
 
 /**
@@ -503,19 +689,16 @@ static ssize_t iio_ch_write_attr(const char *device, const char *channel,
 	struct element_info el_info;
 	struct iio_interface *iio_interface;
 
-	if (!iio_supported_dev(device))
+	iio_interface = iio_get_interface(device, iio_interfaces);
+	if (!iio_interface)
 		return -ENODEV;
 
 	el_info.device_name = device;
 	el_info.channel_name = channel;
 	el_info.attribute_name = attr;
 	el_info.ch_out = ch_out;
-	iio_interface = iio_get_interface(device, iio_interfaces);
 
-	if (!iio_interface)
-		return -ENOENT;
-
-	return iio_rd_wr_attribute(&el_info, (char*)buf, len, iio_interface->iio, 1);
+	return iio_rd_wr_attribute(&el_info, (char*)buf, len, iio_interface, 1);
 }
 
 /**
@@ -531,10 +714,10 @@ static int32_t iio_open_dev(const char *device, size_t sample_size,
 	struct iio_interface *iface;
 	uint32_t ch_mask;
 
-	if (!iio_supported_dev(device))
+	iface = iio_get_interface(device, iio_interfaces);
+	if (!iface)
 		return -ENODEV;
 
-	iface = iio_get_interface(device, iio_interfaces);
 	ch_mask = 0xFFFFFFFF >> (32 - iface->iio->num_ch);
 
 	if (mask & ~ch_mask)
@@ -554,9 +737,9 @@ static int32_t iio_close_dev(const char *device)
 {
 	struct iio_interface *iface;
 
-	if (!iio_supported_dev(device))
-		return FAILURE;
 	iface = iio_get_interface(device, iio_interfaces);
+	if (!iface)
+		return FAILURE;
 	iface->ch_mask = 0;
 
 	return SUCCESS;
@@ -572,10 +755,10 @@ static int32_t iio_get_mask(const char *device, uint32_t *mask)
 {
 	struct iio_interface *iface;
 
-	if (!iio_supported_dev(device))
+	iface = iio_get_interface(device, iio_interfaces);
+	if (!iface)
 		return -ENODEV;
 
-	iface = iio_get_interface(device, iio_interfaces);
 	*mask = iface->ch_mask;
 
 	return SUCCESS;
@@ -661,18 +844,29 @@ static ssize_t iio_write_dev(const char *device, const char *buf,
 }
 
 /**
- * @brief Get a merged xml containing all devices.
- * @param outxml - Generated xml.
+ * @brief Drop the cached context xml, it will be rebuilt on next request.
+ */
+static void iio_xml_invalidate(void)
+{
+	free(iio_xml);
+	iio_xml = NULL;
+	iio_xml_len = 0;
+}
+
+/**
+ * @brief Build the context xml, merging the xml of all devices into a single
+ * buffer, sized from the lengths of the parts.
  * @return SUCCESS in case of success or negative value otherwise.
  */
-static ssize_t iio_get_xml(char **outxml)
+static ssize_t iio_xml_build(void)
 {
-	char *xml, *tmp_xml, *tmp_xml2;
-	uint32_t length;
-	uint16_t i;
-	ssize_t ret;
+	char **dev_xml;
+	uint32_t *dev_len;
+	uint32_t header_len, header_end_len, length, i;
+	char *xml;
+	ssize_t ret = FAILURE;
 
-	char header[] = "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+	static const char header[] = "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
 			"<!DOCTYPE context ["
 			"<!ELEMENT context (device | context-attribute)*>"
 			"<!ELEMENT context-attribute EMPTY>"
@@ -693,46 +887,77 @@ static ssize_t iio_get_xml(char **outxml)
 			"]>"
 			"<context name=\"xml\" description=\"no-OS analog 1.1.0-g0000000 #1 Tue Nov 26 09:52:32 IST 2019 armv7l\" >"
 			"<context-attribute name=\"no-OS\" value=\"1.1.0-g0000000\" />";
-	char header_end[] = "</context>";
+	static const char header_end[] = "</context>";
 
-	if (!outxml)
-		return FAILURE;
+	header_len = sizeof(header) - 1;
+	header_end_len = sizeof(header_end) - 1;
 
-	xml = (char *)calloc(1, strlen(header) + 1);
-	if (!xml)
-		return FAILURE;
+	dev_xml = (char **)calloc(iio_interfaces->num_interfaces + 1,
+				  sizeof(*dev_xml));
+	dev_len = (uint32_t *)calloc(iio_interfaces->num_interfaces + 1,
+				     sizeof(*dev_len));
+	if (!dev_xml || !dev_len)
+		goto error;
 
-	strcpy(xml, header);
+	length = header_len + header_end_len;
 	for (i = 0; i < iio_interfaces->num_interfaces; i++) {
-		ret = iio_interfaces->interfaces[i]->get_xml(&tmp_xml,
-				iio_interfaces->interfaces[i]->iio);
-		if (ret < 0)
+		if (iio_interfaces->interfaces[i]->get_xml(&dev_xml[i],
+				iio_interfaces->interfaces[i]->iio) < 0)
 			goto error;
+		dev_len[i] = strlen(dev_xml[i]);
+		length += dev_len[i];
+	}
 
-		length = strlen(xml);
-		tmp_xml2 = (char *)realloc(xml, strlen(xml) + strlen(tmp_xml) + 1);
-		if (!tmp_xml2)
-			goto error;
+	xml = (char *)malloc(length + 1);
+	if (!xml)
+		goto error;
 
-		xml = tmp_xml2;
-		strcpy((xml + length), tmp_xml);
+	memcpy(xml, header, header_len);
+	length = header_len;
+	for (i = 0; i < iio_interfaces->num_interfaces; i++) {
+		memcpy(xml + length, dev_xml[i], dev_len[i]);
+		length += dev_len[i];
 	}
+	memcpy(xml + length, header_end, header_end_len + 1);
+	length += header_end_len;
 
-	length = strlen(xml);
-	tmp_xml = (char *)realloc(xml, strlen(xml) + strlen(header_end) + 1);
-	if (!tmp_xml)
-		goto error;
+	iio_xml_invalidate();
+	iio_xml = xml;
+	iio_xml_len = length;
+	ret = SUCCESS;
+error:
+	if (dev_xml)
+		for (i = 0; i < iio_interfaces->num_interfaces; i++)
+			free(dev_xml[i]);
+	free(dev_xml);
+	free(dev_len);
 
-	xml = tmp_xml;
-	strcpy((xml + length), header_end);
+	return ret;
+}
 
-	*outxml = xml;
+/**
+ * @brief Get a merged xml containing all devices.
+ * The xml is built once and cached until an interface is registered or
+ * unregistered. The caller ("libtinyiiod") frees the returned buffer, so a
+ * copy of the cached xml is handed out.
+ * @param outxml - Generated xml.
+ * @return SUCCESS in case of success or negative value otherwise.
+ */
+static ssize_t iio_get_xml(char **outxml)
+{
+	if (!outxml || !iio_interfaces)
+		return FAILURE;
 
-	return SUCCESS;
-error:
-	free(xml);
+	if (!iio_xml && iio_xml_build() < 0)
+		return FAILURE;
+
+	*outxml = (char *)malloc(iio_xml_len + 1);
+	if (!*outxml)
+		return FAILURE;
 
-	return FAILURE;
+	memcpy(*outxml, iio_xml, iio_xml_len + 1);
+
+	return SUCCESS;
 }
 
 /**
@@ -745,6 +970,7 @@ ssize_t iio_register(struct iio_interface_init_par *init_par)
 {
 	struct iio_interface *iio_interface;
 	struct iio_interface **temp_interfaces;
+	int16_t i;
 
 	if (!(iio_interfaces)) {
 		iio_interfaces = (struct iio_interfaces *)calloc(1,
@@ -780,7 +1006,21 @@ ssize_t iio_register(struct iio_interface_init_par *init_par)
 	iio_interface->read_data = init_par->read_data;
 	iio_interface->write_data = init_par->write_data;
 
-	iio_interfaces->interfaces[iio_interfaces->num_interfaces - 1] = iio_interface;
+	if (iio_interface_index_init(iio_interface) < 0) {
+		free(iio_interface);
+		iio_interfaces->num_interfaces--;
+		return -ENOMEM;
+	}
+
+	/* keep the list sorted by name, for "iio_get_interface()" */
+	for (i = iio_interfaces->num_interfaces - 1; i > 0; i--) {
+		if (strcmp(iio_interface->name,
+			   iio_interfaces->interfaces[i - 1]->name) >= 0)
+			break;
+		iio_interfaces->interfaces[i] = iio_interfaces->interfaces[i - 1];
+	}
+	iio_interfaces->interfaces[i] = iio_interface;
+	iio_xml_invalidate();
 
 	return SUCCESS;
 }
@@ -814,6 +1054,7 @@ ssize_t iio_unregister(const char *device_name)
 
 	for(i = 0; i < iio_interfaces->num_interfaces; i++) {
 		if (!strcmp(device_name, iio_interfaces->interfaces[i]->name)) {
+			iio_interface_index_remove(iio_interfaces->interfaces[i]);
 			free(iio_interfaces->interfaces[i]);
 			deleted = 1;
 			continue;
@@ -822,6 +1063,8 @@ ssize_t iio_unregister(const char *device_name)
 	}
 
 	interfaces->num_interfaces = iio_interfaces->num_interfaces - 1;
+	iio_last_interface = NULL;
+	iio_xml_invalidate();
 	free(iio_interfaces);
 	iio_interfaces = interfaces;
 
@@ -880,9 +1123,13 @@ ssize_t iio_remove(struct tinyiiod *iiod)
 {
 	uint8_t i;
 
-	for (i = 0; i < iio_interfaces->num_interfaces; i++)
+	for (i = 0; i < iio_interfaces->num_interfaces; i++) {
+		iio_interface_index_remove(iio_interfaces->interfaces[i]);
 		free(iio_interfaces->interfaces[i]);
+	}
 
+	iio_last_interface = NULL;
+	iio_xml_invalidate();
 	free(iio_interfaces);
 	tinyiiod_destroy(iiod);
 
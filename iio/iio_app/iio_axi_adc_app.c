@@ -82,6 +82,7 @@ int32_t iio_axi_adc_app_init(struct iio_axi_adc_app_desc **desc,
 		.adc_ddr_base = ADC_DDR_BASEADDR,
 		.dcache_invalidate_range = (void (*)(uint32_t,
 						     uint32_t))Xil_DCacheInvalidateRange,
+		.scan_type = init->rx_scan_type,
 	};
 
 	status = iio_axi_adc_init(&iio_axi_adc_inst, &iio_axi_adc_init_par);
@@ -89,7 +90,8 @@ int32_t iio_axi_adc_app_init(struct iio_axi_adc_app_desc **desc,
 		return FAILURE;
 
 	iio_axi_adc_device = iio_axi_adc_create_device(iio_axi_adc_inst->adc->name,
-			     iio_axi_adc_inst->adc->num_channels);
+			     iio_axi_adc_inst->adc->num_channels,
+			     &iio_axi_adc_inst->scan_type);
 	if (!iio_axi_adc_device)
 		return FAILURE;
 
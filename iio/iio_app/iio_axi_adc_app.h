@@ -70,6 +70,8 @@ struct iio_axi_adc_app_init_param {
 	struct axi_adc *rx_adc;
 	/** Receive DMA device */
 	struct axi_dmac *rx_dmac;
+	/** Sample format of the ADC channels, NULL for le:S16/16>>0 */
+	const struct scan_type *rx_scan_type;
 };
 
 /******************************************************************************/
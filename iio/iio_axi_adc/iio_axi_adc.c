@@ -76,6 +76,21 @@ ssize_t iio_axi_adc_init(struct iio_axi_adc **iio_axi_adc,
 	iio_adc->dmac = init->dmac;
 	iio_adc->adc_ddr_base = init->adc_ddr_base;
 	iio_adc->dcache_invalidate_range = init->dcache_invalidate_range;
+	if (init->scan_type)
+		iio_adc->scan_type = *init->scan_type;
+	else
+		iio_adc->scan_type = (struct scan_type) {
+			.sign = 's',
+			.realbits = 16,
+			.storagebits = 16,
+			.shift = 0,
+			.is_big_endian = false,
+		};
+	iio_adc->sample_size = iio_adc->scan_type.storagebits / 8;
+	if (!iio_adc->sample_size) {
+		free(iio_adc);
+		return FAILURE;
+	}
 
 	*iio_axi_adc = iio_adc;
 
@@ -411,6 +426,7 @@ ssize_t iio_axi_adc_get_xml(char** xml, struct iio_device *iio_dev)
 	struct xml_attribute *att = NULL;
 	struct xml_node *channel = NULL;
 	struct xml_node *device = NULL;
+	const struct scan_type *scan_type;
 	char buff[256];
 	ssize_t ret;
 	uint16_t i;
@@ -463,7 +479,16 @@ ssize_t iio_axi_adc_get_xml(char** xml, struct iio_device *iio_dev)
 		ret = xml_add_attribute(attribute, att);
 		if (ret < 0)
 			goto error;
-		ret = xml_create_attribute(&att, "format", "le:S16/16&gt;&gt;0");
+		scan_type = iio_dev->channels[i]->scan_type;
+		if (scan_type)
+			sprintf(buff, "%s:%c%d/%d&gt;&gt;%d",
+				scan_type->is_big_endian ? "be" : "le",
+				scan_type->sign == 'u' ? 'U' : 'S',
+				scan_type->realbits, scan_type->storagebits,
+				scan_type->shift);
+		else
+			strcpy(buff, "le:S16/16&gt;&gt;0");
+		ret = xml_create_attribute(&att, "format", buff);
 		if (ret < 0)
 			goto error;
 		ret = xml_add_attribute(attribute, att);
@@ -548,10 +573,11 @@ ssize_t iio_axi_adc_delete_device(struct iio_device *iio_device)
  * and attributes.
  * @param device_name - Device name.
  * @param num_ch - Number of channels that the device has.
+ * @param scan_type - Sample format of the channels, must outlive the device.
  * @return iio_device or NULL, in case of failure.
  */
 struct iio_device *iio_axi_adc_create_device(const char *device_name,
-		uint16_t num_ch)
+		uint16_t num_ch, const struct scan_type *scan_type)
 {
 	struct iio_device *iio_device;
 	const uint8_t num_ch_digits = 3;
@@ -586,6 +612,7 @@ struct iio_device *iio_axi_adc_create_device(const char *device_name,
 			goto error;
 		iio_device->channels[i]->attributes = iio_voltage_attributes;
 		iio_device->channels[i]->ch_out = false;
+		iio_device->channels[i]->scan_type = scan_type;
 	}
 
 	iio_device->channels[i] = NULL;
@@ -599,7 +626,108 @@ error:
 }
 
 /**
- * @brief Transfer data from device into RAM.
+ * @brief Get the gather plan of a channel mask, building it if the mask
+ * changed since the last call.
+ * @param iio_adc - Physical instance of a iio_axi_adc device.
+ * @param ch_mask - Opened channels mask.
+ * @return The plan or NULL if no channel of the device is enabled.
+ */
+static const struct iio_axi_adc_plan *iio_axi_adc_get_plan(
+	struct iio_axi_adc *iio_adc, uint32_t ch_mask)
+{
+	struct iio_axi_adc_plan *plan = &iio_adc->plan;
+	uint8_t num_channels = min(iio_adc->adc->num_channels,
+				   IIO_AXI_ADC_MAX_CHANNELS);
+	uint8_t i;
+
+	if (plan->num_ch && (plan->ch_mask == ch_mask))
+		return plan;
+
+	plan->num_ch = 0;
+	for (i = 0; i < num_channels; i++)
+		if (ch_mask & BIT(i))
+			plan->ch[plan->num_ch++] = i;
+	plan->ch_mask = ch_mask;
+
+	return plan->num_ch ? plan : NULL;
+}
+
+/**
+ * @brief Gather the samples of the enabled channels from interleaved data.
+ * Single channels and channel pairs, e.g. one of two or two of four
+ * channels, are copied without walking the plan for each frame.
+ * @param plan - Gather plan.
+ * @param dst - Destination of the enabled channels samples.
+ * @param src - Interleaved samples of all channels.
+ * @param num_channels - Number of interleaved channels.
+ * @param sample_size - Size of a sample in bytes.
+ * @param frames - Number of sample frames (one sample of each channel).
+ */
+static void iio_axi_adc_deinterleave(const struct iio_axi_adc_plan *plan,
+				     uint8_t *dst, const uint8_t *src,
+				     uint8_t num_channels, uint8_t sample_size,
+				     size_t frames)
+{
+	uint32_t frame_size = num_channels * sample_size;
+	const uint16_t *src16 = (const uint16_t *)src;
+	const uint32_t *src32 = (const uint32_t *)src;
+	uint16_t *dst16 = (uint16_t *)dst;
+	uint32_t *dst32 = (uint32_t *)dst;
+	size_t i;
+	uint8_t k;
+
+	if (plan->num_ch == num_channels) {
+		memcpy(dst, src, frames * frame_size);
+		return;
+	}
+
+	if (sample_size == 2) {
+		if (plan->num_ch == 1) {
+			src16 += plan->ch[0];
+			for (i = 0; i < frames; i++, src16 += num_channels)
+				*dst16++ = *src16;
+		} else if ((plan->num_ch == 2) && !(num_channels & 1) &&
+			   !(plan->ch[0] & 1) &&
+			   (plan->ch[1] == plan->ch[0] + 1)) {
+			/* Adjacent I/Q pair: one 32-bit word per frame. */
+			src32 += plan->ch[0] / 2;
+			for (i = 0; i < frames; i++, src32 += num_channels / 2) {
+				memcpy(dst, src32, sizeof(*src32));
+				dst += sizeof(*src32);
+			}
+		} else if (plan->num_ch == 2) {
+			for (i = 0; i < frames; i++, src16 += num_channels) {
+				*dst16++ = src16[plan->ch[0]];
+				*dst16++ = src16[plan->ch[1]];
+			}
+		} else {
+			for (i = 0; i < frames; i++, src16 += num_channels)
+				for (k = 0; k < plan->num_ch; k++)
+					*dst16++ = src16[plan->ch[k]];
+		}
+	} else if (sample_size == 4) {
+		if (plan->num_ch == 1) {
+			src32 += plan->ch[0];
+			for (i = 0; i < frames; i++, src32 += num_channels)
+				*dst32++ = *src32;
+		} else {
+			for (i = 0; i < frames; i++, src32 += num_channels)
+				for (k = 0; k < plan->num_ch; k++)
+					*dst32++ = src32[plan->ch[k]];
+		}
+	} else {
+		for (i = 0; i < frames; i++, src += frame_size)
+			for (k = 0; k < plan->num_ch; k++) {
+				memcpy(dst, src + plan->ch[k] * sample_size,
+				       sample_size);
+				dst += sample_size;
+			}
+	}
+}
+
+/**
+ * @brief Start transferring data from device into RAM. The transfer is
+ * completed by the first iio_axi_adc_read_dev() call.
  * @param iio_inst - Physical instance of a iio_axi_adc device.
  * @param bytes_count - Number of bytes to transfer.
  * @param ch_mask - Opened channels mask.
@@ -608,6 +736,7 @@ error:
 ssize_t iio_axi_adc_transfer_dev_to_mem(void *iio_inst, size_t bytes_count,
 					uint32_t ch_mask)
 {
+	const struct iio_axi_adc_plan *plan;
 	struct iio_axi_adc *iio_adc;
 	ssize_t ret, bytes;
 
@@ -615,18 +744,49 @@ ssize_t iio_axi_adc_transfer_dev_to_mem(void *iio_inst, size_t bytes_count,
 		return FAILURE;
 
 	iio_adc = (struct iio_axi_adc *)iio_inst;
-	bytes = (bytes_count * iio_adc->adc->num_channels) / hweight8(ch_mask);
+	plan = iio_axi_adc_get_plan(iio_adc, ch_mask);
+	if (!plan)
+		return FAILURE;
+	bytes = (bytes_count * iio_adc->adc->num_channels) / plan->num_ch;
+
+	if (iio_adc->xfer)
+		axi_dmac_transfer_stop(iio_adc->dmac);
 
 	iio_adc->dmac->flags = 0;
-	ret = axi_dmac_transfer(iio_adc->dmac,
-				iio_adc->adc_ddr_base, bytes);
+	ret = axi_dmac_transfer_submit(iio_adc->dmac,
+				       iio_adc->adc_ddr_base, bytes,
+				       NULL, NULL, &iio_adc->xfer);
+	if (ret < 0) {
+		iio_adc->xfer = NULL;
+		return ret;
+	}
+
+	return bytes_count;
+}
+
+/**
+ * @brief Wait for the capture started by iio_axi_adc_transfer_dev_to_mem().
+ * @param iio_adc - Physical instance of a iio_axi_adc device.
+ * @return SUCCESS in case of success or negative value otherwise.
+ */
+static ssize_t iio_axi_adc_wait_capture(struct iio_axi_adc *iio_adc)
+{
+	struct axi_dmac_xfer *xfer = iio_adc->xfer;
+	ssize_t ret;
+
+	if (!xfer)
+		return SUCCESS;
+
+	iio_adc->xfer = NULL;
+	ret = axi_dmac_transfer_wait(iio_adc->dmac, xfer,
+				     AXI_DMAC_TIMEOUT_INFINITE);
 	if (ret < 0)
 		return ret;
 
 	if (iio_adc->dcache_invalidate_range)
-		iio_adc->dcache_invalidate_range(iio_adc->adc_ddr_base, bytes);
+		iio_adc->dcache_invalidate_range(xfer->address, xfer->size);
 
-	return bytes_count;
+	return SUCCESS;
 }
 
 /**
@@ -645,10 +805,11 @@ ssize_t iio_axi_adc_transfer_dev_to_mem(void *iio_inst, size_t bytes_count,
 ssize_t iio_axi_adc_read_dev(void *iio_inst, char *pbuf, size_t offset,
 			     size_t bytes_count, uint32_t ch_mask)
 {
+	const struct iio_axi_adc_plan *plan;
 	struct iio_axi_adc *iio_adc;
-	uint32_t i, j = 0, current_ch = 0;
-	uint16_t *pbuf16;
-	size_t samples;
+	uint8_t num_channels;
+	size_t frames;
+	ssize_t ret;
 
 	if (!iio_inst)
 		return FAILURE;
@@ -657,25 +818,22 @@ ssize_t iio_axi_adc_read_dev(void *iio_inst, char *pbuf, size_t offset,
 		return FAILURE;
 
 	iio_adc = (struct iio_axi_adc *)iio_inst;
-	pbuf16 = (uint16_t*)pbuf;
-	samples = (bytes_count * iio_adc->adc->num_channels) / hweight8(
-			  ch_mask);
 
-	samples /= 2; /* because of uint16_t *pbuf16 = (uint16_t*)pbuf; */
-	offset = (offset * iio_adc->adc->num_channels) / hweight8(ch_mask);
+	ret = iio_axi_adc_wait_capture(iio_adc);
+	if (ret < 0)
+		return ret;
 
-	for (i = 0; i < samples; i++) {
+	plan = iio_axi_adc_get_plan(iio_adc, ch_mask);
+	if (!plan)
+		return FAILURE;
 
-		if (ch_mask & BIT(current_ch)) {
-			pbuf16[j] = *(uint16_t*)(iio_adc->adc_ddr_base + offset + i * 2);
-			j++;
-		}
+	num_channels = iio_adc->adc->num_channels;
+	frames = bytes_count / (plan->num_ch * iio_adc->sample_size);
+	offset = (offset * num_channels) / plan->num_ch;
 
-		if (current_ch + 1 < iio_adc->adc->num_channels)
-			current_ch++;
-		else
-			current_ch = 0;
-	}
+	iio_axi_adc_deinterleave(plan, (uint8_t *)pbuf,
+				 (const uint8_t *)(uintptr_t)(iio_adc->adc_ddr_base + offset),
+				 num_channels, iio_adc->sample_size, frames);
 
 	return bytes_count;
 }
@@ -46,15 +46,32 @@
 #include <stdio.h>
 #include "iio_types.h"
 
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+/* Maximum number of channels, one bit per channel in ch_mask */
+#define IIO_AXI_ADC_MAX_CHANNELS	32
+
+
 /******************************************************************************/
 /*************************** Types Declarations *******************************/
 /******************************************************************************/
 
+/* Channels to gather from the interleaved DDR data for a channel mask. */
+struct iio_axi_adc_plan {
+	uint32_t ch_mask;
+	uint8_t num_ch;
+	uint8_t ch[IIO_AXI_ADC_MAX_CHANNELS];
+};
+
 struct iio_axi_adc_init_par {
 	struct axi_adc *adc;
 	struct axi_dmac *dmac;
 	uint32_t adc_ddr_base;
 	void (*dcache_invalidate_range)(uint32_t address, uint32_t bytes_count);
+	/* Sample format of the core channels, NULL for le:S16/16>>0 */
+	const struct scan_type *scan_type;
 };
 
 struct iio_axi_adc {
@@ -62,6 +79,14 @@ struct iio_axi_adc {
 	struct axi_dmac *dmac;
 	uint32_t adc_ddr_base;
 	void (*dcache_invalidate_range)(uint32_t address, uint32_t bytes_count);
+	/* Capture in flight, completed on the first read */
+	struct axi_dmac_xfer *xfer;
+	/* Gather plan of the last used channel mask */
+	struct iio_axi_adc_plan plan;
+	/* Sample format of the core channels */
+	struct scan_type scan_type;
+	/* Size in bytes of a sample in DDR, from scan_type */
+	uint8_t sample_size;
 };
 
 /******************************************************************************/
@@ -74,7 +99,7 @@ ssize_t iio_axi_adc_init(struct iio_axi_adc **iio_axi_adc,
 ssize_t iio_axi_adc_remove(struct iio_axi_adc *iio_axi_adc);
 /* Create iio_device. */
 struct iio_device *iio_axi_adc_create_device(const char *device_name,
-		uint16_t num_ch);
+		uint16_t num_ch, const struct scan_type *scan_type);
 /* Delete iio_device. */
 ssize_t iio_axi_adc_delete_device(struct iio_device *iio_adc_device);
 /* Transfer data from ADC into RAM: "capture" */
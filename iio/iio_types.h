@@ -63,10 +63,29 @@ struct iio_attribute {
 			 const struct iio_ch_info *channel);
 };
 
+/**
+ * @struct scan_type
+ * @brief Format of the buffer samples of a channel.
+ */
+struct scan_type {
+	/** 's' for signed, 'u' for unsigned */
+	char sign;
+	/** Number of valid bits of data */
+	uint8_t realbits;
+	/** Size of a sample in the buffer, in bits */
+	uint8_t storagebits;
+	/** Shift right by this before masking out realbits */
+	uint8_t shift;
+	/** Samples are big endian */
+	bool is_big_endian;
+};
+
 struct iio_channel {
 	char *name;
 	struct iio_attribute **attributes;
 	bool ch_out;
+	/** Buffer sample format, NULL if the channel has no scan element */
+	const struct scan_type *scan_type;
 };
 
 struct iio_device {
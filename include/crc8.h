@@ -0,0 +1,81 @@
+/***************************************************************************//**
+ *   @file   crc8.h
+ *   @brief  Header file of the table driven CRC8 utility.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef CRC8_H_
+#define CRC8_H_
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************************************************************/
+/********************** Macros and Constants Definitions **********************/
+/******************************************************************************/
+
+/** Number of entries of a CRC8 lookup table */
+#define CRC8_TABLE_SIZE			256
+
+/** CRC-8-ATM (CCITT) polynomial x^8 + x^2 + x + 1, used by most SPI CRCs */
+#define CRC8_ATM_POLYNOMIAL		0x07
+
+/** Declare a CRC8 lookup table, filled by crc8_populate_msb() */
+#define DECLARE_CRC8_TABLE(_table) \
+	static uint8_t _table[CRC8_TABLE_SIZE]
+
+/******************************************************************************/
+/************************ Variables Declarations ******************************/
+/******************************************************************************/
+
+/** Precomputed lookup table of CRC8_ATM_POLYNOMIAL, MSB first */
+extern const uint8_t crc8_atm_table[CRC8_TABLE_SIZE];
+
+/******************************************************************************/
+/************************ Functions Declarations ******************************/
+/******************************************************************************/
+
+/* Fill the lookup table of a polynomial, for MSB first CRCs. */
+void crc8_populate_msb(uint8_t table[CRC8_TABLE_SIZE], uint8_t polynomial);
+
+/* Compute the CRC8 of a buffer, one table lookup per byte. */
+uint8_t crc8(const uint8_t table[CRC8_TABLE_SIZE], const uint8_t *pdata,
+	     size_t nbytes, uint8_t crc);
+
+#endif // CRC8_H_
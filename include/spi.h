@@ -102,6 +102,28 @@ typedef struct spi_desc {
 	void		*extra;
 } spi_desc;
 
+/**
+ * @struct spi_msg
+ * @brief One segment of a SPI message. All the segments of a message are sent
+ * in a single transaction, the chip select stays asserted between segments
+ * unless "cs_change" is set. Controllers that cannot hold the chip select
+ * between transfers (e.g. the Xilinx PS SPI) send the segments of a chip
+ * select frame as one transfer, so a "delay_usecs" is only honoured on the
+ * segments that end a frame.
+ */
+typedef struct spi_msg {
+	/** Data to be written, NULL to write zeros ("rx_buff" must be set) */
+	uint8_t		*tx_buff;
+	/** Buffer for the read data, NULL to discard it */
+	uint8_t		*rx_buff;
+	/** Number of bytes of the segment */
+	uint32_t	bytes_number;
+	/** Deassert the chip select after this segment */
+	uint8_t		cs_change;
+	/** Delay after this segment, in microseconds */
+	uint32_t	delay_usecs;
+} spi_msg;
+
 /******************************************************************************/
 /************************ Functions Declarations ******************************/
 /******************************************************************************/
@@ -118,4 +140,9 @@ int32_t spi_write_and_read(struct spi_desc *desc,
 			   uint8_t *data,
 			   uint16_t bytes_number);
 
+/* Transfer a message made of several segments. */
+int32_t spi_transfer_msgs(struct spi_desc *desc,
+			  struct spi_msg *msgs,
+			  uint32_t msgs_number);
+
 #endif // SPI_H_
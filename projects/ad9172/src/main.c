@@ -56,6 +56,8 @@
 #include "spi_extra.h"
 #include "gpio.h"
 #include "gpio_extra.h"
+#include "timer.h"
+#include "poll_timeout.h"
 
 #ifdef DAC_DMA_EXAMPLE
 #include "axi_dmac.h"
@@ -190,8 +192,21 @@ int main(void)
 	struct axi_jesd204_tx *tx_jesd;
 	struct adxcvr *tx_adxcvr;
 	struct axi_dac *tx_dac;
+	struct timer_init_param timer_init_par = {
+		.freq_hz = 0,
+		.load_value = 0,
+		.extra = NULL
+	};
+	struct timer_desc *poll_timer;
 	int32_t status;
 
+	/* Free running time source for the driver polls. Without one the
+	 * polls fall back to counting their own delays. */
+	if (timer_init(&poll_timer, &timer_init_par) == SUCCESS) {
+		timer_start(poll_timer);
+		poll_timeout_set_timer(poll_timer);
+	}
+
 	status = hmc7044_init(&hmc7044_device, &hmc7044_param);
 	if (status != SUCCESS) {
 		printf("hmc7044_init() error: %"PRIi32"\n", status);
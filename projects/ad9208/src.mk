@@ -24,11 +24,13 @@ SRCS += $(DRIVERS)/axi_core/axi_adc_core/axi_adc_core.c			\
 	$(DRIVERS)/axi_core/jesd204/axi_jesd204_rx.c			\
 	$(DRIVERS)/axi_core/jesd204/axi_jesd204_tx.c			\
 	$(DRIVERS)/axi_core/jesd204/xilinx_transceiver.c		\
-	$(NO-OS)/util/util.c
+	$(NO-OS)/util/util.c						\
+	$(NO-OS)/util/poll_timeout.c
 SRCS +=	$(PLATFORM_DRIVERS)/axi_io.c					\
 	$(PLATFORM_DRIVERS)/spi.c					\
 	$(PLATFORM_DRIVERS)/gpio.c					\
-	$(PLATFORM_DRIVERS)/delay.c
+	$(PLATFORM_DRIVERS)/delay.c					\
+	$(PLATFORM_DRIVERS)/timer.c
 INCS := $(PROJECT)/src/parameters.h
 INCS += $(DRIVERS)/frequency/hmc7044/hmc7044.h				\
 	$(DRIVERS)/adc/ad9208/ad9208.h					\
@@ -50,4 +52,6 @@ INCS +=	$(INCLUDE)/axi_io.h						\
 	$(INCLUDE)/gpio.h						\
 	$(INCLUDE)/error.h						\
 	$(INCLUDE)/delay.h						\
-	$(INCLUDE)/util.h
\ No newline at end of file
+	$(INCLUDE)/util.h						\
+	$(INCLUDE)/timer.h						\
+	$(INCLUDE)/poll_timeout.h
\ No newline at end of file
@@ -60,6 +60,8 @@
 #include "spi_extra.h"
 #include "gpio.h"
 #include "gpio_extra.h"
+#include "timer.h"
+#include "poll_timeout.h"
 
 int main(void)
 {
@@ -361,9 +363,22 @@ int main(void)
 	struct adxcvr *rx_0_adxcvr, *rx_1_adxcvr;
 	struct axi_adc *rx_0_adc, *rx_1_adc;
 	struct axi_dmac *rx_dmac;
+	struct timer_init_param timer_init_par = {
+		.freq_hz = 0,
+		.load_value = 0,
+		.extra = NULL
+	};
+	struct timer_desc *poll_timer;
 	int32_t status;
 	uint32_t size;
 
+	/* Free running time source for the driver polls. Without one the
+	 * polls fall back to counting their own delays. */
+	if (timer_init(&poll_timer, &timer_init_par) == SUCCESS) {
+		timer_start(poll_timer);
+		poll_timeout_set_timer(poll_timer);
+	}
+
 	status = hmc7044_init(&hmc7044_device, &hmc7044_param);
 	if (status != SUCCESS) {
 		xil_printf("hmc7044_init() error: %"PRIi32"\n", status);
@@ -524,6 +524,12 @@ int32_t ad9361_init (struct ad9361_rf_phy **ad9361_phy,
 	phy->bist_tone_level_dB = 0;
 	phy->bist_tone_mask = 0;
 
+	if (HAVE_SPI_REG_CACHE) {
+		ret = ad9361_spi_cache_enable(phy);
+		if (ret < 0)
+			goto out;
+	}
+
 	ad9361_reset(phy);
 
 	ret = ad9361_spi_read(phy->spi, REG_PRODUCT_ID);
@@ -564,6 +570,7 @@ int32_t ad9361_init (struct ad9361_rf_phy **ad9361_phy,
 	return 0;
 
 out:
+	ad9361_spi_cache_disable(phy);
 	free(phy->spi);
 #ifndef AXI_ADC_NOT_PRESENT
 	free(phy->adc_conv);
@@ -1302,6 +1309,58 @@ int32_t ad9361_rx_fastlock_save(struct ad9361_rf_phy *phy, uint32_t profile,
 	return ad9361_fastlock_save(phy, 0, profile, values);
 }
 
+/**
+ * Build a RX hop table: the fastlock profiles of a list of frequencies are
+ * computed once (synthesizer setup and VCO calibration per frequency) and kept
+ * in host memory, to be swapped into the 8 device profile slots on demand.
+ * @param phy The AD9361 state structure.
+ * @param table The hop table.
+ * @param entry Memory for the profiles, num_entries entries. It can be saved
+ *              and later passed to ad9361_rx_hop_table_init() instead.
+ * @param freq_hz The frequencies (Hz).
+ * @param num_entries The number of frequencies.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_rx_hop_table_build(struct ad9361_rf_phy *phy,
+				  struct ad9361_hop_table *table,
+				  struct ad9361_hop_entry *entry,
+				  const uint64_t *freq_hz, uint32_t num_entries)
+{
+	ad9361_hop_table_init(table, 0, entry, num_entries);
+
+	return ad9361_hop_table_build(phy, table, freq_hz);
+}
+
+/**
+ * Init a RX hop table with previously built profiles.
+ * @param table The hop table.
+ * @param entry The profiles, from ad9361_rx_hop_table_build().
+ * @param num_entries The number of profiles.
+ * @return None.
+ */
+void ad9361_rx_hop_table_init(struct ad9361_hop_table *table,
+			      struct ad9361_hop_entry *entry,
+			      uint32_t num_entries)
+{
+	ad9361_hop_table_init(table, 0, entry, num_entries);
+}
+
+/**
+ * Hop the RX LO to the frequency of a hop table entry. Only the fastlock
+ * recall is done when the profile is already in a device slot, otherwise the
+ * profile is loaded first, replacing the oldest one. The gain table is
+ * reloaded when the entry is in another gain table band.
+ * @param phy The AD9361 state structure.
+ * @param table The hop table.
+ * @param index The entry.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_rx_hop(struct ad9361_rf_phy *phy,
+		      struct ad9361_hop_table *table, uint32_t index)
+{
+	return ad9361_hop(phy, table, index);
+}
+
 /**
  * Power down the RX Local Oscillator.
  * @param phy The AD9361 state structure.
@@ -1817,6 +1876,57 @@ int32_t ad9361_tx_fastlock_save(struct ad9361_rf_phy *phy, uint32_t profile,
 	return ad9361_fastlock_save(phy, 1, profile, values);
 }
 
+/**
+ * Build a TX hop table: the fastlock profiles of a list of frequencies are
+ * computed once (synthesizer setup and VCO calibration per frequency) and kept
+ * in host memory, to be swapped into the 8 device profile slots on demand.
+ * @param phy The AD9361 state structure.
+ * @param table The hop table.
+ * @param entry Memory for the profiles, num_entries entries. It can be saved
+ *              and later passed to ad9361_tx_hop_table_init() instead.
+ * @param freq_hz The frequencies (Hz).
+ * @param num_entries The number of frequencies.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_tx_hop_table_build(struct ad9361_rf_phy *phy,
+				  struct ad9361_hop_table *table,
+				  struct ad9361_hop_entry *entry,
+				  const uint64_t *freq_hz, uint32_t num_entries)
+{
+	ad9361_hop_table_init(table, 1, entry, num_entries);
+
+	return ad9361_hop_table_build(phy, table, freq_hz);
+}
+
+/**
+ * Init a TX hop table with previously built profiles.
+ * @param table The hop table.
+ * @param entry The profiles, from ad9361_tx_hop_table_build().
+ * @param num_entries The number of profiles.
+ * @return None.
+ */
+void ad9361_tx_hop_table_init(struct ad9361_hop_table *table,
+			      struct ad9361_hop_entry *entry,
+			      uint32_t num_entries)
+{
+	ad9361_hop_table_init(table, 1, entry, num_entries);
+}
+
+/**
+ * Hop the TX LO to the frequency of a hop table entry. Only the fastlock
+ * recall is done when the profile is already in a device slot, otherwise the
+ * profile is loaded first, replacing the oldest one.
+ * @param phy The AD9361 state structure.
+ * @param table The hop table.
+ * @param index The entry.
+ * @return 0 in case of success, negative error code otherwise.
+ */
+int32_t ad9361_tx_hop(struct ad9361_rf_phy *phy,
+		      struct ad9361_hop_table *table, uint32_t index)
+{
+	return ad9361_hop(phy, table, index);
+}
+
 /**
  * Power down the TX Local Oscillator.
  * @param phy The AD9361 state structure.
@@ -57,6 +57,8 @@
 #include "axi_dac_core.h"
 #include "axi_dmac.h"
 #include "error.h"
+#include "timer.h"
+#include "poll_timeout.h"
 
 #ifdef IIO_EXAMPLE
 
@@ -480,6 +482,12 @@ int main(void)
 #endif
 	struct gpio_init_param 	gpio_init;
 	gpio_init.extra = &xil_gpio_param;
+	struct timer_init_param timer_init_par = {
+		.freq_hz = 0,
+		.load_value = 0,
+		.extra = NULL
+	};
+	struct timer_desc *poll_timer;
 
 #ifdef ALTERA_PLATFORM
 	if (altera_bridge_init()) {
@@ -488,6 +496,13 @@ int main(void)
 	}
 #endif
 
+	// Free running time source for the driver polls. Without one the
+	// polls fall back to counting their own delays.
+	if (timer_init(&poll_timer, &timer_init_par) == SUCCESS) {
+		timer_start(poll_timer);
+		poll_timeout_set_timer(poll_timer);
+	}
+
 	// NOTE: The user has to choose the GPIO numbers according to desired
 	// carrier board.
 	default_init_param.gpio_resetb.number = GPIO_RESET_PIN;
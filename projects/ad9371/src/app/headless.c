@@ -50,6 +50,8 @@
 #include "util.h"
 #include "error.h"
 #include "delay.h"
+#include "timer.h"
+#include "poll_timeout.h"
 #ifdef ALTERA_PLATFORM
 #include "clk_altera_a10_fpll.h"
 #include "altera_adxcvr.h"
@@ -330,6 +332,12 @@ int main(void)
 	struct axi_dmac *tx_dmac;
 	extern const uint32_t sine_lut_iq[1024];
 #endif
+	struct timer_init_param timer_init_par = {
+		.freq_hz = 0,
+		.load_value = 0,
+		.extra = NULL
+	};
+	struct timer_desc *poll_timer;
 	uint32_t i;
 
 	/* Allocating memory for the errorString */
@@ -343,6 +351,13 @@ int main(void)
 		goto error_0;
 	}
 
+	/* Free running time source for the driver polls. Without one the
+	 * polls fall back to counting their own delays. */
+	if (timer_init(&poll_timer, &timer_init_par) == SUCCESS) {
+		timer_start(poll_timer);
+		poll_timeout_set_timer(poll_timer);
+	}
+
 	/**************************************************************************/
 	/*****      System Clocks Initialization Initialization Sequence      *****/
 	/**************************************************************************/
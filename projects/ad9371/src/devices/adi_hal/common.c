@@ -15,12 +15,14 @@
 #include <errno.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #include "common.h"
 #include "spi.h"
 #include "spi_extra.h"
 #include "gpio_extra.h"
 #include "gpio.h"
 #include "delay.h"
+#include "error.h"
 
 #include "parameters.h"
 
@@ -179,12 +181,72 @@ commonErr_t CMB_SPIWriteByte(spiSettings_t *spiSettings, uint16_t addr,
 commonErr_t CMB_SPIWriteBytes(spiSettings_t *spiSettings, uint16_t *addr,
 			      uint8_t *data, uint32_t count)
 {
-	uint32_t index;
+	struct spi_msg msgs[SPISTREAMFRAMES];
+	uint8_t buf[SPISTREAMFRAMES * 3];
+	uint32_t n;
 
-	for (index = 0; index < count; index++)
-		if (CMB_SPIWriteByte(spiSettings, *(addr + index),
-				     *(data + index)) != COMMONERR_OK)
+	spi_ad_desc->chip_select = spiSettings->chipSelectIndex - 1;
+
+	while (count) {
+		/* one 3 byte write per CS frame, all frames in one transfer */
+		for (n = 0; count && n < SPISTREAMFRAMES; n++, count--) {
+			buf[n * 3] = (uint8_t) ((*addr >> 8) & 0x7f);
+			buf[n * 3 + 1] = (uint8_t) (*addr & 0xff);
+			buf[n * 3 + 2] = *data;
+
+			msgs[n].tx_buff = &buf[n * 3];
+			msgs[n].rx_buff = NULL;
+			msgs[n].bytes_number = 3;
+			msgs[n].cs_change = 1;
+			msgs[n].delay_usecs = 0;
+
+			addr++;
+			data++;
+		}
+
+		if (spi_transfer_msgs(spi_ad_desc, msgs, n) != SUCCESS)
+			return(COMMONERR_FAILED);
+	}
+
+	return(COMMONERR_OK);
+}
+
+commonErr_t CMB_SPIWriteStream(spiSettings_t *spiSettings, uint16_t addr,
+			       uint8_t *data, uint32_t count, uint32_t frameSize)
+{
+	struct spi_msg msgs[SPISTREAMFRAMES];
+	uint8_t buf[SPISTREAMFRAMES][2 + SPISTREAMFRAMESIZE];
+	uint32_t len, n;
+
+	spi_ad_desc->chip_select = spiSettings->chipSelectIndex - 1;
+
+	if (!frameSize)
+		frameSize = count;
+	if (frameSize > SPISTREAMFRAMESIZE)
+		return(COMMONERR_FAILED);
+
+	while (count) {
+		/* one CS frame per message: the address followed by its data */
+		for (n = 0; count && n < SPISTREAMFRAMES; n++) {
+			len = (count < frameSize) ? count : frameSize;
+
+			buf[n][0] = (uint8_t) ((addr >> 8) & 0x7f);
+			buf[n][1] = (uint8_t) (addr & 0xff);
+			memcpy(&buf[n][2], data, len);
+
+			msgs[n].tx_buff = buf[n];
+			msgs[n].rx_buff = NULL;
+			msgs[n].bytes_number = 2 + len;
+			msgs[n].cs_change = 1;
+			msgs[n].delay_usecs = 0;
+
+			data += len;
+			count -= len;
+		}
+
+		if (spi_transfer_msgs(spi_ad_desc, msgs, n) != SUCCESS)
 			return(COMMONERR_FAILED);
+	}
 
 	return(COMMONERR_OK);
 }
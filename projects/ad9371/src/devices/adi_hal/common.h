@@ -27,6 +27,12 @@ extern "C" {
 /* assuming 3 byte SPI message - integer math enforces floor() */
 #define SPIARRAYTRIPSIZE ((SPIARRAYSIZE / 3) * 3)
 
+/* number of CS frames handed to the SPI driver in one transfer */
+#define SPISTREAMFRAMES 64
+
+/* maximum data bytes of a CMB_SPIWriteStream frame (ARM data port width) */
+#define SPISTREAMFRAMESIZE 4
+
 /*========================================
  * Enums and structures
  *=======================================*/
@@ -91,7 +97,10 @@ commonErr_t CMB_setSPIChannel(uint16_t
 commonErr_t CMB_SPIWriteByte(spiSettings_t *spiSettings, uint16_t addr,
 			     uint8_t data); /* single SPI byte write function */
 commonErr_t CMB_SPIWriteBytes(spiSettings_t *spiSettings, uint16_t *addr,
-			      uint8_t *data, uint32_t count);
+			      uint8_t *data, uint32_t count); /* batched SPI byte writes, one CS frame each */
+commonErr_t CMB_SPIWriteStream(spiSettings_t *spiSettings, uint16_t addr,
+			       uint8_t *data, uint32_t count,
+			       uint32_t frameSize); /* streamed writes from addr, frameSize bytes per CS frame, 0 = one frame */
 commonErr_t CMB_SPIReadByte (spiSettings_t *spiSettings, uint16_t addr,
 			     uint8_t *readdata); /* single SPI byte read function */
 commonErr_t CMB_SPIWriteField(spiSettings_t *spiSettings, uint16_t addr,
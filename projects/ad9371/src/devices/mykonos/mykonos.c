@@ -45,6 +45,7 @@ static mykonosErr_t MYKONOS_calculateScaledDeviceClk_kHz(mykonosDevice_t *device
 static mykonosErr_t MYKONOS_calculateDigitalClocks(mykonosDevice_t *device, uint32_t *hsDigClk_kHz, uint32_t *hsDigClkDiv4or5_kHz);
 static mykonosErr_t enableDpdTracking(mykonosDevice_t *device, uint8_t tx1Enable, uint8_t tx2Enable);
 static mykonosErr_t enableClgcTracking(mykonosDevice_t *device, uint8_t tx1Enable, uint8_t tx2Enable);
+static mykonosErr_t mykStreamArmMem(mykonosDevice_t *device, uint32_t address, uint8_t *data, uint32_t byteCount);
 
 /**
  * \brief Verifies the Tx profile members are valid (in range) in the init structure
@@ -8007,6 +8008,9 @@ const char* getMykonosErrorMessage(mykonosErr_t errorCode)
         case MYKONOS_ERR_CLGCATTENTUNCFGGET_NULL_ATTRANGECFGSTRUCT:
             return "Passed structure is null in MYKONOS_getClgcAttenTuningConfig().\n";
 
+        case MYKONOS_ERR_WRITEARMMEM_SPI_FAILED:
+            return "SPI transfer failed while streaming data to ARM memory\n";
+
         default:
             return "Unknown error was encountered.\n";
     }
@@ -13318,14 +13322,12 @@ mykonosErr_t MYKONOS_loadArmConcurrent(mykonosDevice_t *device, uint8_t *binary,
 {
     uint8_t stackPtr[4] = {0};
     uint8_t bootAddr[4] = {0};
-    uint32_t i;
     uint32_t address = MYKONOS_ADDR_ARM_START_PROG_ADDR;
 
-#if MYK_ENABLE_SPIWRITEARRAY == 1
-    uint32_t addrIndex = 0;
-    uint32_t dataIndex = 0;
-    uint32_t spiBufferSize = MYK_SPIWRITEARRAY_BUFFERSIZE;
-    uint16_t addrArray[MYK_SPIWRITEARRAY_BUFFERSIZE] = {0};
+#if MYK_ENABLE_SPIWRITEARRAY == 0
+    uint32_t i;
+#else
+    mykonosErr_t retVal = MYKONOS_ERR_OK;
 #endif
 
 #if (MYKONOS_VERBOSE == 1)
@@ -13376,23 +13378,10 @@ mykonosErr_t MYKONOS_loadArmConcurrent(mykonosDevice_t *device, uint8_t *binary,
 
 #elif (MYK_ENABLE_SPIWRITEARRAY == 1)
 
-        addrIndex = 0;
-        dataIndex = 0;
-        for (i = 0; i < count; i++)
-        {
-            addrArray[addrIndex++] = (MYKONOS_ADDR_ARM_DATA_BYTE_0 | (((address & 0x3) + i) % 4));
-
-            if (addrIndex == spiBufferSize)
-            {
-                CMB_SPIWriteBytes(device->spiSettings, &addrArray[0], &binary[dataIndex], addrIndex);
-                dataIndex = dataIndex + addrIndex;
-                addrIndex = 0;
-            }
-        }
-
-        if (addrIndex > 0)
+        if ((retVal = mykStreamArmMem(device, address, &binary[0], count)) != MYKONOS_ERR_OK)
         {
-            CMB_SPIWriteBytes(device->spiSettings, &addrArray[0], &binary[dataIndex], addrIndex);
+            CMB_writeToLog(ADIHAL_LOG_ERROR, device->spiSettings->chipSelectIndex, retVal, getMykonosErrorMessage(retVal));
+            return retVal;
         }
 
 #endif
@@ -15682,18 +15671,15 @@ mykonosErr_t MYKONOS_readArmMem(mykonosDevice_t *device, uint32_t address, uint8
  * \retval MYKONOS_ERR_OK Function completed successfully
  * \retval MYKONOS_ERR_WRITEARMMEM_NULL_PARM Function parameter data has NULL pointer when byteCount is >0
  * \retval MYKONOS_ERR_WRITEARMMEM_INV_ADDR_PARM ARM memory address is out of range of valid ARM memory
+ * \retval MYKONOS_ERR_WRITEARMMEM_SPI_FAILED A SPI transfer failed while streaming the data
  */
 mykonosErr_t MYKONOS_writeArmMem(mykonosDevice_t *device, uint32_t address, uint8_t *data, uint32_t byteCount)
 {
     /* write address, then data with auto increment enabled. */
     uint8_t dataMem;
-    uint32_t i;
 
-#if MYK_ENABLE_SPIWRITEARRAY == 1
-    uint32_t addrIndex = 0;
-    uint32_t dataIndex = 0;
-    uint32_t spiBufferSize = MYK_SPIWRITEARRAY_BUFFERSIZE;
-    uint16_t addrArray[MYK_SPIWRITEARRAY_BUFFERSIZE] = {0};
+#if MYK_ENABLE_SPIWRITEARRAY == 0
+    uint32_t i;
 #endif
 
 #if (MYKONOS_VERBOSE == 1)
@@ -15753,26 +15739,80 @@ mykonosErr_t MYKONOS_writeArmMem(mykonosDevice_t *device, uint32_t address, uint
 
 #elif (MYK_ENABLE_SPIWRITEARRAY == 1)
 
-    addrIndex = 0;
-    dataIndex = 0;
-    for (i = 0; i < byteCount; i++)
+    return mykStreamArmMem(device, address, data, byteCount);
+
+#endif
+
+    return MYKONOS_ERR_OK;
+}
+
+/**
+ * \brief Private helper to stream a block of bytes into the ARM memory data port
+ *
+ * The data port is MYKONOS_ADDR_ARM_DATA_BYTE_0..3. A 32 bit word is committed
+ * when byte 3 is written, then the ARM address auto increments. Each word is
+ * sent as one SPI streaming transaction with ascending register addresses and
+ * the HAL batches many of them per driver call. The SPI configuration is
+ * restored afterwards, also on failure.
+ *
+ * The ARM address and the ARM_CTL_1 auto increment bit must already be set.
+ *
+ * \param device is structure pointer to the Mykonos data structure containing settings
+ * \param address ARM memory address the data port points to, only bits [1:0] are used
+ * \param data is a pointer to the byte array of data to write
+ * \param byteCount is the number of bytes to write
+ *
+ * \retval MYKONOS_ERR_OK Function completed successfully
+ * \retval MYKONOS_ERR_WRITEARMMEM_SPI_FAILED A SPI transfer failed
+ */
+static mykonosErr_t mykStreamArmMem(mykonosDevice_t *device, uint32_t address, uint8_t *data, uint32_t byteCount)
+{
+    commonErr_t spiErr = COMMONERR_OK;
+    commonErr_t restoreErr = COMMONERR_OK;
+    uint8_t spiConfig0 = 0;
+    uint8_t spiConfig1 = 0;
+    uint32_t headCount = 0;
+
+    static const uint8_t SPI_ADDR_ASCENSION = 0x24;
+    static const uint8_t SPI_SINGLE_INSTRUCTION = 0x80;
+    static const uint32_t ARM_DATA_PORT_WIDTH = 4;
+
+    if ((CMB_SPIReadByte(device->spiSettings, MYKONOS_ADDR_CONFIGURATION_CONTROL_0, &spiConfig0) != COMMONERR_OK) ||
+        (CMB_SPIReadByte(device->spiSettings, MYKONOS_ADDR_SPI_CONFIGURATION_CONTROL_1, &spiConfig1) != COMMONERR_OK) ||
+        (CMB_SPIWriteByte(device->spiSettings, MYKONOS_ADDR_CONFIGURATION_CONTROL_0, (spiConfig0 | SPI_ADDR_ASCENSION)) != COMMONERR_OK) ||
+        (CMB_SPIWriteByte(device->spiSettings, MYKONOS_ADDR_SPI_CONFIGURATION_CONTROL_1, (spiConfig1 & ~SPI_SINGLE_INSTRUCTION)) != COMMONERR_OK))
     {
-        addrArray[addrIndex++] = (MYKONOS_ADDR_ARM_DATA_BYTE_0 | (((address & 0x3) + i) % 4));
+        return MYKONOS_ERR_WRITEARMMEM_SPI_FAILED;
+    }
 
-        if (addrIndex == spiBufferSize)
+    /* a start address that is not word aligned begins inside the port */
+    if ((address & 0x3) != 0)
+    {
+        headCount = ARM_DATA_PORT_WIDTH - (address & 0x3);
+        if (headCount > byteCount)
         {
-            CMB_SPIWriteBytes(device->spiSettings, &addrArray[0], &data[dataIndex], addrIndex);
-            dataIndex = dataIndex + addrIndex;
-            addrIndex = 0;
+            headCount = byteCount;
         }
+
+        spiErr = CMB_SPIWriteStream(device->spiSettings, (uint16_t)(MYKONOS_ADDR_ARM_DATA_BYTE_0 | (address & 0x3)), &data[0], headCount, 0);
     }
 
-    if (addrIndex > 0)
+    if ((spiErr == COMMONERR_OK) && (headCount < byteCount))
     {
-        CMB_SPIWriteBytes(device->spiSettings, &addrArray[0], &data[dataIndex], addrIndex);
+        spiErr = CMB_SPIWriteStream(device->spiSettings, MYKONOS_ADDR_ARM_DATA_BYTE_0, &data[headCount], (byteCount - headCount), ARM_DATA_PORT_WIDTH);
     }
 
-#endif
+    /* restore the SPI mode, also when the load failed */
+    restoreErr = CMB_SPIWriteByte(device->spiSettings, MYKONOS_ADDR_SPI_CONFIGURATION_CONTROL_1, spiConfig1);
+    if (restoreErr == COMMONERR_OK)
+    {
+        restoreErr = CMB_SPIWriteByte(device->spiSettings, MYKONOS_ADDR_CONFIGURATION_CONTROL_0, spiConfig0);
+    }
+
+    if ((spiErr != COMMONERR_OK) || (restoreErr != COMMONERR_OK))
+    {
+        return MYKONOS_ERR_WRITEARMMEM_SPI_FAILED;
+    }
 
     return MYKONOS_ERR_OK;
 }
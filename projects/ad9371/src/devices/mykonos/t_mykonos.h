@@ -563,6 +563,8 @@ typedef enum
 
 	MYKONOS_ERR_CLGCATTENTUNCFGGET_NULL_ATTRANGECFGSTRUCT,
 
+	MYKONOS_ERR_WRITEARMMEM_SPI_FAILED,
+
     MYKONOS_ERR_END
 } mykonosErr_t;
 
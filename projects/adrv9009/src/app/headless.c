@@ -19,6 +19,8 @@
 #include "delay.h"
 #include "parameters.h"
 #include "util.h"
+#include "timer.h"
+#include "poll_timeout.h"
 #include "axi_dac_core.h"
 #include "axi_adc_core.h"
 #include "axi_dmac.h"
@@ -175,6 +177,12 @@ int main(void)
 
 	hal.extra_gpio = &hal_gpio_param;
 #endif
+	struct timer_init_param timer_init_par = {
+		.freq_hz = 0,
+		.load_value = 0,
+		.extra = NULL
+	};
+	struct timer_desc *poll_timer;
 	int t;
 	struct adi_hal hal[TALISE_DEVICE_ID_MAX];
 	taliseDevice_t tal[TALISE_DEVICE_ID_MAX];
@@ -192,6 +200,13 @@ int main(void)
 
 	printf("Hello\n");
 
+	// Free running time source for the driver polls. Without one the
+	// polls fall back to counting their own delays.
+	if (timer_init(&poll_timer, &timer_init_par) == SUCCESS) {
+		timer_start(poll_timer);
+		poll_timeout_set_timer(poll_timer);
+	}
+
 	/**********************************************************/
 	/**********************************************************/
 	/************ Talise Initialization Sequence *************/
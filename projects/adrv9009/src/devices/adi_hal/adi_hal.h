@@ -74,6 +74,12 @@ extern "C" {
 /* Minimum HAL_SPIWRITEARRAY_BUFFERSIZE = 18 */
 #define HAL_SPIWRITEARRAY_BUFFERSIZE 341
 
+/* Number of frames handed at once to the SPI driver by ADIHAL_spiWriteStream */
+#define HAL_SPISTREAM_FRAMES 32
+
+/* Maximum data bytes of an ADIHAL_spiWriteStream frame (ARM DMA port width) */
+#define HAL_SPISTREAM_FRAME_SIZE 4
+
 /*============================================================================
  * ADI Device Hardware Control Functions
  *===========================================================================*/
@@ -324,6 +330,52 @@ adiHalErr_t ADIHAL_spiWriteByte(void *devHalInfo, uint16_t addr, uint8_t data);
 adiHalErr_t  ADIHAL_spiWriteBytes(void *devHalInfo, uint16_t *addr,
 				  uint8_t *data, uint32_t count);
 
+/**
+ * \brief Streams a data buffer to a window of consecutive SPI registers
+ *
+ * This function allows much faster loads of large data sets (ARM firmware,
+ * stream processor image) through a data port made of consecutive SPI
+ * registers. The data is split in frames of frameSize bytes and each frame
+ * is sent in a single SPI streaming transaction: the address is sent once,
+ * followed by the frame bytes written to addr, addr + 1, ... The last frame
+ * may be shorter. Many frames are handed to the platform SPI driver at once.
+ *
+ * The device must be in SPI streaming mode with ascending addresses while
+ * this function is used.
+ *
+ * Returns an error of type adiHalErr_t. Error returned will depend on platform
+ * specific implementation. API expects ADIHAL_OK if function completed successfully.
+ * Any other value represents an error or warning to the API. Error return list
+ * below provides possible errors from customer implementation.
+ *
+ * \pre This function may only be used after the required SPI drivers and resources
+ * are opened by the ADIHAL_openHw() function call and not after ADIHAL_closeHW.
+ *
+ * <B>Dependencies</B>
+ * --Application and Platform Specific modules
+ *
+ * \param devHalInfo Pointer to Platform HAL defined structure containing
+ *                   hardware settings describing the device of interest.
+ *
+ * \param addr 15-bit SPI address of the first register of the window.
+ *
+ * \param data An array of 8-bit data values to write.
+ *
+ * \param count The number of bytes to write.
+ *
+ * \param frameSize The number of bytes written per SPI transaction, the
+ *                  size of the register window. 0 sends the whole buffer in
+ *                  one transaction.
+ *
+ * \retval ADIHAL_OK if function completed successfully.
+ * \retval ADIHAL_GEN_SW if device references is unknown.
+ * \retval ADIHAL_SPI_FAIL if function failed to complete SPI transaction
+ * \retval ADIHAL_WAIT_TIMEOUT if HAL timeout expired before SPI transaction could be completed.
+ * \retval ADIHAL_WARNING if function failed to access non-critical resource eg logging
+ */
+adiHalErr_t ADIHAL_spiWriteStream(void *devHalInfo, uint16_t addr,
+				  uint8_t *data, uint32_t count, uint32_t frameSize);
+
 /**
  * \brief Performs a Single SPI Read from an ADI Device
  *
@@ -41,6 +41,7 @@
 /***************************** Include Files **********************************/
 /******************************************************************************/
 #include <stdio.h>
+#include <string.h>
 #include "adi_hal.h"
 #include "parameters.h"
 #include "spi.h"
@@ -175,6 +176,47 @@ adiHalErr_t ADIHAL_spiWriteBytes(void *devHalInfo,
 	return ADIHAL_OK;
 }
 
+adiHalErr_t ADIHAL_spiWriteStream(void *devHalInfo, uint16_t addr,
+				  uint8_t *data, uint32_t count, uint32_t frameSize)
+{
+	struct adi_hal *devHalData = (struct adi_hal *)devHalInfo;
+	struct spi_msg msgs[HAL_SPISTREAM_FRAMES];
+	uint8_t buf[HAL_SPISTREAM_FRAMES][2 + HAL_SPISTREAM_FRAME_SIZE];
+	uint32_t len, n;
+	int32_t status;
+
+	if (!frameSize)
+		frameSize = count;
+	if (frameSize > HAL_SPISTREAM_FRAME_SIZE)
+		return ADIHAL_GEN_SW;
+
+	while (count) {
+		/* one CS frame per message: the address followed by its data */
+		for (n = 0; count && n < HAL_SPISTREAM_FRAMES; n++) {
+			len = (count < frameSize) ? count : frameSize;
+
+			buf[n][0] = (addr >> 8) & 0x7F;
+			buf[n][1] = addr & 0xFF;
+			memcpy(&buf[n][2], data, len);
+
+			msgs[n].tx_buff = buf[n];
+			msgs[n].rx_buff = NULL;
+			msgs[n].bytes_number = 2 + len;
+			msgs[n].cs_change = 1;
+			msgs[n].delay_usecs = 0;
+
+			data += len;
+			count -= len;
+		}
+
+		status = spi_transfer_msgs(devHalData->spi_adrv_desc, msgs, n);
+		if (status != SUCCESS)
+			return ADIHAL_SPI_FAIL;
+	}
+
+	return ADIHAL_OK;
+}
+
 adiHalErr_t ADIHAL_spiReadByte(void *devHalInfo,
 			       uint16_t addr, uint8_t *readdata)
 {
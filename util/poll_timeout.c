@@ -0,0 +1,142 @@
+/***************************************************************************//**
+ *   @file   poll_timeout.c
+ *   @brief  Implementation of the poll with timeout utility.
+********************************************************************************
+ * Copyright 2020(c) Analog Devices, Inc.
+ *
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *  - Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in
+ *    the documentation and/or other materials provided with the
+ *    distribution.
+ *  - Neither the name of Analog Devices, Inc. nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *  - The use of this software may or may not infringe the patent rights
+ *    of one or more patent holders.  This license does not release you
+ *    from the requirement that you obtain separate licenses from these
+ *    patent holders to use this software.
+ *  - Use of the software either in source or binary form, must be run
+ *    on or directly connected to an Analog Devices Inc. component.
+ *
+ * THIS SOFTWARE IS PROVIDED BY ANALOG DEVICES "AS IS" AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, NON-INFRINGEMENT,
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL ANALOG DEVICES BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, INTELLECTUAL PROPERTY RIGHTS, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/******************************************************************************/
+/***************************** Include Files **********************************/
+/******************************************************************************/
+
+#include <errno.h>
+#include "error.h"
+#include "delay.h"
+#include "poll_timeout.h"
+
+/******************************************************************************/
+/************************ Variables Definitions *******************************/
+/******************************************************************************/
+
+/** Monotonic time source, NULL until the platform provides one */
+static struct timer_desc *poll_timer;
+
+/******************************************************************************/
+/************************ Functions Definitions *******************************/
+/******************************************************************************/
+
+/**
+ * @brief Set the free running timer used as monotonic time source.
+ *
+ * The timer must be started and count up. Without a timer the elapsed time is
+ * taken as the sum of the delays done between checks, which never expires a
+ * poll early but may stretch it by the time spent in the checks themselves.
+ * @param desc - Pointer to the timer descriptor, NULL to drop the time source.
+ * @return SUCCESS in case of success, FAILURE otherwise.
+ */
+int32_t poll_timeout_set_timer(struct timer_desc *desc)
+{
+	if (desc && !desc->freq_hz)
+		return FAILURE;
+
+	poll_timer = desc;
+
+	return SUCCESS;
+}
+
+/**
+ * @brief Poll a condition until it is met or the timeout expires.
+ *
+ * The condition is first checked POLL_TIMEOUT_SPIN_COUNT times back to back,
+ * so events that complete within a bus access cost no delay at all. After
+ * that the delay between checks starts at POLL_TIMEOUT_MIN_DELAY_US and
+ * doubles up to POLL_TIMEOUT_MAX_DELAY_US. The condition is always checked
+ * once more after the timeout expired.
+ * @param cond - Callback returning a positive value when the condition is met,
+ *               0 when it is not met yet and a negative error code on failure.
+ * @param ctx - Context passed to the callback.
+ * @param timeout_us - Timeout in microseconds.
+ * @return SUCCESS when the condition is met, -ETIMEDOUT when the timeout
+ *         expired or the negative error code returned by the callback.
+ */
+int32_t poll_timeout(int32_t (*cond)(void *ctx), void *ctx,
+		     uint32_t timeout_us)
+{
+	uint64_t elapsed_ticks = 0;
+	uint64_t timeout_ticks;
+	uint32_t delay_us = POLL_TIMEOUT_MIN_DELAY_US;
+	uint32_t spin = POLL_TIMEOUT_SPIN_COUNT;
+	uint32_t last, now;
+	int32_t ret;
+
+	if (!cond)
+		return FAILURE;
+
+	if (poll_timer) {
+		timeout_ticks = ((uint64_t)timeout_us * poll_timer->freq_hz) /
+				1000000;
+		if (timer_counter_get(poll_timer, &last) != SUCCESS)
+			return FAILURE;
+	} else {
+		timeout_ticks = timeout_us;
+	}
+
+	while (1) {
+		ret = cond(ctx);
+		if (ret)
+			return (ret > 0) ? SUCCESS : ret;
+
+		if (elapsed_ticks >= timeout_ticks)
+			return -ETIMEDOUT;
+
+		if (spin) {
+			spin--;
+		} else {
+			udelay(delay_us);
+			if (!poll_timer)
+				elapsed_ticks += delay_us;
+			if (delay_us < POLL_TIMEOUT_MAX_DELAY_US)
+				delay_us = (delay_us * 2 > POLL_TIMEOUT_MAX_DELAY_US) ?
+					   POLL_TIMEOUT_MAX_DELAY_US : delay_us * 2;
+		}
+
+		if (poll_timer) {
+			/* unsigned difference, wraps with the counter */
+			if (timer_counter_get(poll_timer, &now) != SUCCESS)
+				return FAILURE;
+			elapsed_ticks += (uint32_t)(now - last);
+			last = now;
+		}
+	}
+}
@@ -213,30 +213,85 @@ ssize_t xml_delete_node(struct xml_node *node)
 }
 
 /**
- * print string to xml_document.
- * @param *doc
- * @param *data to be written.
- * @return SUCCESS in case of success or negative value otherwise
+ * compute the length of the printed xml tree
+ * @param *node pointer to parent node, that contains the xml tree
+ * @return number of chars needed to print the tree, without the terminator
  */
-static ssize_t xml_print_to_doc(struct xml_document *doc, char *data)
+static uint32_t xml_get_length(struct xml_node *node)
 {
-	uint32_t calc_len, print_len;
+	uint32_t len;
+	uint16_t i;
 
-	calc_len = strlen(data) + 1;
-	char *buff = realloc(doc->buff, doc->index + calc_len);
-	if (!buff)
-		return FAILURE;
-	doc->buff = buff;
-	print_len = sprintf(&(doc->buff[doc->index]), "%s", data);
-	if(print_len != calc_len - 1)
-		return FAILURE;
-	doc->index +=print_len;
+	/* "<name " */
+	len = strlen(node->name) + 2;
+	for (i = 0; i < node->attr_cnt; i++)
+		/* "name=\"value\" " */
+		len += strlen(node->attributes[i]->name) +
+		       strlen(node->attributes[i]->value) + 4;
 
-	return SUCCESS;
+	if (node->children_cnt == 0)
+		/* "/>\n" */
+		return len + 3;
+
+	/* ">\n" ... "</name>\n" */
+	len += 2 + strlen(node->name) + 4;
+	for (i = 0; i < node->children_cnt; i++)
+		len += xml_get_length(node->children[i]);
+
+	return len;
+}
+
+/**
+ * copy string to buffer.
+ * @param *buff destination
+ * @param *data to be written
+ * @return pointer past the written data
+ */
+static char *xml_print(char *buff, const char *data)
+{
+	uint32_t len = strlen(data);
+
+	memcpy(buff, data, len);
+
+	return buff + len;
+}
+
+/**
+ * print xml tree into a buffer large enough to hold it
+ * @param *buff destination
+ * @param *node pointer to parent node, that contains the xml tree
+ * @return pointer past the written data
+ */
+static char *xml_print_node(char *buff, struct xml_node *node)
+{
+	uint16_t i;
+
+	buff = xml_print(buff, "<");
+	buff = xml_print(buff, node->name);
+	buff = xml_print(buff, " ");
+
+	for (i = 0; i < node->attr_cnt; i++) {
+		buff = xml_print(buff, node->attributes[i]->name);
+		buff = xml_print(buff, "=\"");
+		buff = xml_print(buff, node->attributes[i]->value);
+		buff = xml_print(buff, "\" ");
+	}
+
+	if (node->children_cnt == 0)
+		return xml_print(buff, "/>\n");
+
+	buff = xml_print(buff, ">\n");
+	for (i = 0; i < node->children_cnt; i++)
+		buff = xml_print_node(buff, node->children[i]);
+	buff = xml_print(buff, "</");
+	buff = xml_print(buff, node->name);
+
+	return xml_print(buff, ">\n");
 }
 
 /**
  * print xml tree into a xml document
+ * the document is sized once, from the length of the tree
  * @param **document
  * @param *node pointer to parent node, that contains the xml tree
  * @return SUCCESS in case of success or negative value otherwise
@@ -244,9 +299,9 @@ static ssize_t xml_print_to_doc(struct xml_document *doc, char *data)
 ssize_t xml_create_document(struct xml_document **document,
 			    struct xml_node *node)
 {
-	uint16_t i;
-	ssize_t ret;
 	struct xml_document *doc;
+	uint32_t len;
+	char *buff;
 
 	if(!document)
 		return FAILURE;
@@ -260,58 +315,15 @@ ssize_t xml_create_document(struct xml_document **document,
 	}
 	doc = *document;
 
-	ret = xml_print_to_doc(doc, "<");
-	if (ret < 0)
-		goto error;
-	ret = xml_print_to_doc(doc, node->name);
-	if (ret < 0)
-		goto error;
-	ret = xml_print_to_doc(doc, " ");
-	if (ret < 0)
+	len = xml_get_length(node);
+	buff = realloc(doc->buff, doc->index + len + 1);
+	if (!buff)
 		goto error;
+	doc->buff = buff;
 
-	for (i = 0; i < node->attr_cnt; i++) {
-		ret = xml_print_to_doc(doc, node->attributes[i]->name);
-		if (ret < 0)
-			goto error;
-		ret = xml_print_to_doc(doc, "=\"");
-		if (ret < 0)
-			goto error;
-		ret = xml_print_to_doc(doc, node->attributes[i]->value);
-		if (ret < 0)
-			goto error;
-		ret = xml_print_to_doc(doc, "\" ");
-		if (ret < 0)
-			goto error;
-	}
-
-	if (node->children_cnt == 0) {
-		ret = xml_print_to_doc(doc, "/>\n");
-		if (ret < 0)
-			goto error;
-
-		return SUCCESS;
-	} else {
-		ret = xml_print_to_doc(doc, ">\n");
-		if (ret < 0)
-			goto error;
-	}
-
-	for (i = 0; i < node->children_cnt; i++) {
-		ret = xml_create_document(document, node->children[i]);
-		if (ret < 0)
-			return ret;
-	}
-
-	ret = xml_print_to_doc(doc, "</");
-	if (ret < 0)
-		goto error;
-	ret = xml_print_to_doc(doc, node->name);
-	if (ret < 0)
-		goto error;
-	ret = xml_print_to_doc(doc, ">\n");
-	if (ret < 0)
-		goto error;
+	buff = xml_print_node(doc->buff + doc->index, node);
+	*buff = '\0';
+	doc->index += len;
 
 	return SUCCESS;
 